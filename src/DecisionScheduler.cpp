@@ -0,0 +1,193 @@
+/**
+ * @file   DecisionScheduler.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the scheduler answering RequestGameOperation messages before the turn deadline.
+ */
+
+#include "DecisionScheduler.hpp"
+#include <sstream>
+#include <LibClient.hpp>
+#include <util/TimeUtils.hpp>
+
+namespace libclient {
+
+    void AnytimeResult::propose(const std::shared_ptr<spy::gameplay::BaseOperation> &operation, double value) {
+        if (operation == nullptr) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        proposals++;
+        if (best == nullptr || value > bestValue) {
+            best = operation;
+            bestValue = value;
+        }
+    }
+
+    std::shared_ptr<spy::gameplay::BaseOperation> AnytimeResult::getBest() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return best;
+    }
+
+    std::size_t AnytimeResult::getNumberOfProposals() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return proposals;
+    }
+
+    DecisionScheduler::DecisionScheduler(LibClient &c, std::size_t numberOfThreads)
+            : client(c), pool(numberOfThreads) {}
+
+    DecisionScheduler::~DecisionScheduler() {
+        cancel();
+    }
+
+    void DecisionScheduler::addEvaluator(Evaluator evaluator) {
+        evaluators.push_back(std::move(evaluator));
+    }
+
+    void DecisionScheduler::setSafetyMargin(std::chrono::milliseconds margin) {
+        safetyMargin = margin;
+    }
+
+    void DecisionScheduler::setFallbackBudget(std::chrono::milliseconds budget) {
+        fallbackBudget = budget;
+    }
+
+    void DecisionScheduler::setLogger(Logger l) {
+        std::lock_guard<std::mutex> lock(mutex);
+        logger = std::move(l);
+    }
+
+    std::optional<std::chrono::steady_clock::time_point> DecisionScheduler::getDeadline() const {
+        const auto &requested = client.getOperationRequestTime();
+        if (!requested.has_value()) {
+            return std::nullopt;
+        }
+        auto limit = util::getTurnPhaseLimit(client.getSettings());
+        if (!limit.has_value()) {
+            return requested.value() + fallbackBudget;
+        }
+        auto roundTrip = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(client.getRoundTripTime()));
+        return requested.value() + limit.value() - roundTrip - safetyMargin;
+    }
+
+    void DecisionScheduler::onRequestGameOperation() {
+        // previous controller may wait for the model lock -> join it before taking the lock
+        cancel();
+
+        auto lock = client.network.lockModel();
+        auto requested = client.getOperationRequestTime().value_or(std::chrono::steady_clock::now());
+        auto deadline = getDeadline().value_or(requested + fallbackBudget);
+        // copy, cache of the client is invalidated by the next message
+        auto operations = client.getLegalOperations();
+        lock.unlock();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            cancelled = false;
+        }
+        controller = std::thread(&DecisionScheduler::decide, this, std::move(operations), requested, deadline);
+    }
+
+    void DecisionScheduler::cancel() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            cancelled = true;
+        }
+        condition.notify_all();
+        if (controller.joinable()) {
+            controller.join();
+        }
+    }
+
+    std::vector<DecisionRecord> DecisionScheduler::getDecisionLog() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return records;
+    }
+
+    void DecisionScheduler::decide(std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> operations,
+                                   std::chrono::steady_clock::time_point requested,
+                                   std::chrono::steady_clock::time_point deadline) {
+        AnytimeResult result;
+        std::atomic<bool> stop{false};
+        std::vector<std::future<void>> futures;
+
+        if (!operations.empty()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                running = evaluators.size();
+            }
+            for (const auto &evaluator: evaluators) {
+                futures.push_back(pool.submit([this, &evaluator, &operations, &result, &stop]() {
+                    try {
+                        evaluator(operations, result, stop);
+                    } catch (...) {
+                        // evaluator failed, its proposals so far are kept
+                    }
+                    std::lock_guard<std::mutex> lock(mutex);
+                    running--;
+                    condition.notify_all();
+                }));
+            }
+        }
+
+        bool sendOperation;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait_until(lock, deadline, [this]() { return running == 0 || cancelled; });
+            sendOperation = !cancelled;
+        }
+        stop = true;
+
+        if (sendOperation && !operations.empty()) {
+            DecisionRecord record;
+            auto best = result.getBest();
+            record.fallback = best == nullptr;
+            if (record.fallback) {
+                best = operations.front();
+            }
+
+            // network thread and callbacks use the model under the same lock -> send and read under it
+            auto lock = client.network.lockModel();
+            record.sent = client.network.sendGameOperation(best, client.getSettings());
+
+            auto now = std::chrono::steady_clock::now();
+            auto limit = util::getTurnPhaseLimit(client.getSettings());
+            auto end = limit.has_value() ? requested + limit.value() : deadline;
+            record.character = client.getActiveCharacter();
+            record.roundTripTime = limit.has_value() ? client.getRoundTripTime() : 0;
+            lock.unlock();
+
+            record.budget = std::chrono::duration<double>(deadline - requested).count();
+            record.safetyMargin = limit.has_value() ? std::chrono::duration<double>(safetyMargin).count() : 0;
+            record.used = std::chrono::duration<double>(now - requested).count();
+            record.slack = std::chrono::duration<double>(end - now).count();
+            record.proposals = result.getNumberOfProposals();
+            log(record);
+        }
+
+        // evaluators reference local result and operations
+        for (auto &future: futures) {
+            pool.wait(future);
+        }
+    }
+
+    void DecisionScheduler::log(const DecisionRecord &record) {
+        Logger l;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            records.push_back(record);
+            l = logger;
+        }
+        if (l == nullptr) {
+            return;
+        }
+        std::ostringstream line;
+        line << "decision for " << record.character.to_string() << ": used " << record.used << "s of "
+             << record.budget << "s budget (round trip " << record.roundTripTime << "s, margin " << record.safetyMargin
+             << "s), slack " << record.slack << "s, " << record.proposals << " proposals"
+             << (record.fallback ? ", fallback" : "") << (record.sent ? "" : ", not sent");
+        l(line.str());
+    }
+}
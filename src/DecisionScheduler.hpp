@@ -0,0 +1,173 @@
+/**
+ * @file   DecisionScheduler.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the scheduler answering RequestGameOperation messages before the turn deadline.
+ */
+
+#ifndef LIBCLIENT_DECISIONSCHEDULER_HPP
+#define LIBCLIENT_DECISIONSCHEDULER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <datatypes/gameplay/BaseOperation.hpp>
+#include <util/ThreadPool.hpp>
+#include <util/UUID.hpp>
+
+namespace libclient {
+
+    class LibClient;
+
+    /**
+     * best operation proposed by the evaluators so far, evaluators may propose any number of times
+     */
+    class AnytimeResult {
+        public:
+            /**
+             * @param operation proposed operation (should be one of the legal operations)
+             * @param value value of operation, higher is better
+             */
+            void propose(const std::shared_ptr<spy::gameplay::BaseOperation> &operation, double value);
+
+            /**
+             * @return best proposed operation, nullptr if nothing was proposed
+             */
+            [[nodiscard]] std::shared_ptr<spy::gameplay::BaseOperation> getBest() const;
+
+            [[nodiscard]] std::size_t getNumberOfProposals() const;
+
+        private:
+            mutable std::mutex mutex;
+            std::shared_ptr<spy::gameplay::BaseOperation> best;
+            double bestValue = 0;
+            std::size_t proposals = 0;
+    };
+
+    /**
+     * timing of one answered RequestGameOperation message (all times in seconds)
+     */
+    struct DecisionRecord {
+        spy::util::UUID character;
+        double budget = 0;          // time from request to deadline
+        double roundTripTime = 0;   // measured round trip time subtracted from budget
+        double safetyMargin = 0;    // configured margin subtracted from budget
+        double used = 0;            // time from request until operation was sent
+        double slack = 0;           // turn phase limit - used, negative if answer was too late
+        std::size_t proposals = 0;
+        bool fallback = false;      // no evaluator proposed an operation, first legal operation was sent
+        bool sent = false;
+    };
+
+    /**
+     * runs registered evaluators in anytime fashion when an operation is requested and sends the best proposed
+     * operation via sendGameOperation before the deadline
+     * deadline = request arrival + turn phase limit - round trip time - safety margin
+     * onRequestGameOperation has to be called from the callback of the client
+     * threading: the operation is sent from the controller thread of the scheduler, not from the network thread (the
+     * websocket client offers no way to run code on it), so every access to the model holds one mutex
+     * (Network::lockModel): the network thread while it processes a message, the controller while it sends and reads
+     * settings, active character and round trip time, evaluators while they read anything through LibClient and
+     * callbacks while they use the client
+     * callbacks are called without the lock, so onRequestGameOperation first joins the previous controller (which may
+     * wait for the lock) and takes the lock afterwards
+     */
+    class DecisionScheduler {
+        public:
+            /**
+             * all evaluators run at the same time on threads of the pool, so they have to be thread safe and have to
+             * hold client.network.lockModel() (briefly) whenever they read the model through LibClient
+             * @param operations legal operations of the active character (copy owned by the scheduler)
+             * @param result proposals of the evaluator
+             * @param stop set when the deadline is reached, evaluator should return soon after
+             */
+            using Evaluator = std::function<void(
+                    const std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> &operations,
+                    AnytimeResult &result, const std::atomic<bool> &stop)>;
+
+            using Logger = std::function<void(const std::string &)>;
+
+            /**
+             * @param client client to send operations with (has to outlive scheduler)
+             * @param numberOfThreads number of threads for evaluators, 0 uses all cores
+             */
+            explicit DecisionScheduler(LibClient &client, std::size_t numberOfThreads = 0);
+
+            ~DecisionScheduler();
+
+            DecisionScheduler(const DecisionScheduler &) = delete;
+
+            DecisionScheduler &operator=(const DecisionScheduler &) = delete;
+
+            void addEvaluator(Evaluator evaluator);
+
+            /**
+             * @param margin time kept free before the turn phase limit (in addition to round trip time)
+             */
+            void setSafetyMargin(std::chrono::milliseconds margin);
+
+            /**
+             * @param budget time used for evaluation if match config has no turn phase limit
+             */
+            void setFallbackBudget(std::chrono::milliseconds budget);
+
+            /**
+             * @param logger called with one line per decision, nullptr disables logging
+             */
+            void setLogger(Logger logger);
+
+            /**
+             * has to be called with Network::lockModel held
+             * @return time at which the operation for the current request is sent, nullopt if nothing was requested
+             */
+            [[nodiscard]] std::optional<std::chrono::steady_clock::time_point> getDeadline() const;
+
+            /**
+             * starts evaluators for the current request, returns immediately
+             * operation is sent at the deadline or as soon as all evaluators finished
+             * has to be called without Network::lockModel held (takes it after cancel)
+             */
+            void onRequestGameOperation();
+
+            /**
+             * stops evaluation of current request without sending an operation
+             * has to be called without Network::lockModel held, joins the controller which may wait for it
+             */
+            void cancel();
+
+            /**
+             * @return records of all decisions in order
+             */
+            [[nodiscard]] std::vector<DecisionRecord> getDecisionLog() const;
+
+        private:
+            LibClient &client;
+            util::ThreadPool pool;
+            std::vector<Evaluator> evaluators;
+            std::chrono::milliseconds safetyMargin{500};
+            std::chrono::milliseconds fallbackBudget{1000};
+            Logger logger;
+
+            std::thread controller;
+            mutable std::mutex mutex;
+            std::condition_variable condition;
+            std::size_t running = 0; // evaluators of current request, guarded by mutex
+            bool cancelled = false; // guarded by mutex
+            std::vector<DecisionRecord> records; // guarded by mutex
+
+            void decide(std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> operations,
+                        std::chrono::steady_clock::time_point requested,
+                        std::chrono::steady_clock::time_point deadline);
+
+            void log(const DecisionRecord &record);
+    };
+}
+
+#endif //LIBCLIENT_DECISIONSCHEDULER_HPP
@@ -8,6 +8,8 @@
 #include "LibClient.hpp"
 
 #include <utility>
+#include <chrono>
+#include <limits>
 #include <string>
 #include <datatypes/gameplay/BaseOperation.hpp>
 #include <datatypes/gameplay/GadgetAction.hpp>
@@ -20,6 +22,7 @@
 #include <datatypes/gameplay/JanitorAction.hpp>
 #include <datatypes/gameplay/Exfiltration.hpp>
 #include <datatypes/gameplay/RetireAction.hpp>
+#include <util/OperationDispatch.hpp>
 
 namespace libclient {
 
@@ -165,7 +168,13 @@ namespace libclient {
     }
 
     LibClient::LibClient(Callback *callback) : model(std::make_shared<Model>()),
-                                               network(callback, model) {}
+                                               network(callback, model) {
+        model->safePlanner.setDistanceFunction(
+                [&distances = model->gameState.distances](const spy::util::Point &from,
+                                                          const spy::util::Point &target) {
+                    return distances.getDistanceToNeighbour(from, target);
+                });
+    }
 
     bool LibClient::setName(const std::string &name) {
         if (network.getState() != Network::NetworkState::NOT_CONNECTED &&
@@ -198,8 +207,14 @@ namespace libclient {
                 return false;
             }
 
-            return model->aiState.addFaction(id, faction == FactionEnum::NEUTRAL ? model->aiState.npcFaction
-                                                                                 : model->aiState.enemyFaction);
+            bool added = model->aiState.addFaction(id, faction == FactionEnum::NEUTRAL ? model->aiState.npcFaction
+                                                                                       : model->aiState.enemyFaction);
+            if (added) {
+                // keep state view up to date, only the changed character is applied
+                model->aiState.applySureInformation(model->gameState.state,
+                                                    iAmPlayer1.value() ? FactionEnum::PLAYER1 : FactionEnum::PLAYER2);
+            }
+            return added;
         } else {
             // client is spectator
             switch (faction) {
@@ -248,8 +263,166 @@ namespace libclient {
         return model->aiState.hasCharacterGadget(id, type);
     }
 
+    model::GadgetOwnership LibClient::getGadgetOwnership() const {
+        return model->aiState.getGadgetOwnership();
+    }
+
+    void LibClient::setFactionCounts(const model::FactionCounts &counts) {
+        // own faction size is known exactly after REQUEST_EQUIPMENT_CHOICE
+        model->aiState.factionCounts.enemy = counts.enemy;
+        model->aiState.factionCounts.npc = counts.npc;
+        if (model->gameState.chosenCharacter.empty()) {
+            model->aiState.factionCounts.my = counts.my;
+        }
+    }
+
+    model::FactionSolution LibClient::getFactionProbabilities() const {
+        return model->aiState.solveFactions();
+    }
+
+    const model::AIState &LibClient::getAIState() const {
+        return model->aiState;
+    }
+
+    std::optional<unsigned int> LibClient::getDistance(const spy::util::Point &from,
+                                                       const spy::util::Point &to) const {
+        return model->gameState.distances.getDistance(from, to);
+    }
+
+    std::optional<spy::util::Point> LibClient::getNextStep(const spy::util::Point &from,
+                                                           const spy::util::Point &to) const {
+        return model->gameState.distances.getNextStep(from, to);
+    }
+
+    const model::DistanceCache &LibClient::getDistanceCache() const {
+        return model->gameState.distances;
+    }
+
+    const model::Bitboards &LibClient::getBitboards() const {
+        return model->gameState.bitboards;
+    }
+
+    std::shared_ptr<const model::Reachability>
+    LibClient::getReachableFields(const spy::util::UUID &id, std::optional<unsigned int> movePoints,
+                                  bool passOccupied) const {
+        if (!movePoints.has_value()) {
+            auto character = model->gameState.state.getCharacters().findByUUID(id);
+            movePoints = character != model->gameState.state.getCharacters().end() ? character->getMovePoints() : 0;
+        }
+        return model->gameState.reachability.get(model->gameState.bitboards, model->gameState.state, id,
+                                                 movePoints.value(), passOccupied);
+    }
+
+    bool LibClient::isInSight(const spy::util::Point &from, const spy::util::Point &to) const {
+        return model->gameState.lineOfSight.isInSight(model->gameState.state, from, to);
+    }
+
+    std::vector<spy::util::Point> LibClient::getFieldsInSight(const spy::util::Point &from, unsigned int range) const {
+        return model->gameState.lineOfSight.getFieldsInSight(model->gameState.state, from, range);
+    }
+
+    std::optional<spy::util::UUID> LibClient::getCharacterAt(const spy::util::Point &p) const {
+        return model->gameState.characterGrid.getCharacterAt(p);
+    }
+
+    std::vector<spy::util::UUID>
+    LibClient::getCharactersInRange(const spy::util::Point &center, unsigned int distance) const {
+        return model->gameState.characterGrid.getCharactersInRange(center, distance);
+    }
+
+    std::optional<unsigned int> LibClient::safePosToIndex(const spy::util::Point &p) const {
+        return model->aiState.safePosToIndex(p);
+    }
+
     unsigned int LibClient::safePosToIndex(const spy::gameplay::State &s, const spy::util::Point &p) const {
-        return model->aiState.safePosToIndex(s, p);
+        auto index = safePosToIndex(p);
+        if (!index.has_value() && !model->aiState.safes.isBuilt()) {
+            // same row major numbering as the registry built later
+            model::SafeRegistry registry;
+            registry.build(s.getMap());
+            index = registry.getIndex(p);
+        }
+        return index.value_or(std::numeric_limits<unsigned int>::max());
+    }
+
+    const model::SafeRegistry &LibClient::getSafeRegistry() const {
+        return model->aiState.safes;
+    }
+
+    const std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> &LibClient::getLegalOperations() {
+        static const std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> none;
+        if (network.getState() != Network::NetworkState::IN_GAME_ACTIVE) {
+            return none;
+        }
+        const auto &operations = model->operationGenerator.generate(model->gameState, model->clientState);
+        network.cacheValidation(operations);
+        return operations;
+    }
+
+    model::Simulator LibClient::createSimulator() const {
+        auto me = model->clientState.amIPlayer1() ? spy::character::FactionEnum::PLAYER1
+                                                  : spy::character::FactionEnum::PLAYER2;
+        return model::Simulator(model->gameState.state, model->aiState, model->gameState.settings, me);
+    }
+
+    model::SearchResult LibClient::search(model::RootBanditSearch &service) {
+        auto deadline = std::chrono::steady_clock::now() + service.getBudget(model->gameState.settings);
+        auto me = model->clientState.amIPlayer1() ? spy::character::FactionEnum::PLAYER1
+                                                  : spy::character::FactionEnum::PLAYER2;
+        return service.search(getLegalOperations(), model->gameState.state, model->aiState,
+                              model->gameState.settings, me, deadline);
+    }
+
+    const std::optional<std::chrono::steady_clock::time_point> &LibClient::getOperationRequestTime() const {
+        return model->clientState.operationRequested;
+    }
+
+    double LibClient::getRoundTripTime() const {
+        return model->clientState.roundTripTime;
+    }
+
+    const model::ValidationStatistics &LibClient::getValidationStatistics() const {
+        return model->validationCache.getStatistics();
+    }
+
+    model::ValidationBenchmark LibClient::benchmarkValidation(unsigned int repetitions) {
+        return network.benchmarkValidation(repetitions);
+    }
+
+    model::MemoryUsage LibClient::getMemoryUsage() const {
+        return model::measureMemoryUsage(*model);
+    }
+
+    void LibClient::setMemoryTracking(bool enabled) {
+        model->trackMemory = enabled;
+        model->memoryPeak = enabled ? model::measureMemoryUsage(*model) : model::MemoryUsage{};
+    }
+
+    const model::MemoryUsage &LibClient::getMemoryPeak() const {
+        return model->memoryPeak;
+    }
+
+    bool LibClient::setAllocationCounting(bool enabled) {
+        if (enabled) {
+            model->receivedAllocations.clear();
+            model->sentAllocations.clear();
+        }
+        model->countAllocations = enabled;
+        return util::AllocationCounter::isAvailable();
+    }
+
+    std::map<spy::network::messages::MessageTypeEnum, util::AllocationStatistics>
+    LibClient::getReceivedAllocations() const {
+        return model->receivedAllocations.get();
+    }
+
+    std::map<spy::network::messages::MessageTypeEnum, util::AllocationStatistics>
+    LibClient::getSentAllocations() const {
+        return model->sentAllocations.get();
+    }
+
+    const model::SafePlan &LibClient::getSafePlan() {
+        return model->safePlanner.plan(model->aiState, model->gameState.state, model->gameState.settings);
     }
 
     const std::set<unsigned int> &LibClient::getOpenedSafes() const {
@@ -281,23 +454,16 @@ namespace libclient {
     }
 
     std::string LibClient::operationToString(const std::shared_ptr<const spy::gameplay::BaseOperation> op) const {
-        using spy::gameplay::OperationEnum;
-
         std::string operationString;
 
-        auto variant = this->getInformation().at(
+        const auto &variant = this->getInformation().at(
                 spy::network::messages::MetaInformationKey::CONFIGURATION_CHARACTER_INFORMATION);
-        auto characterInformation = std::get<std::vector<spy::character::CharacterInformation>>(variant);
-
-        auto operationType = op->getType();
+        const auto &characterInformation = std::get<std::vector<spy::character::CharacterInformation>>(variant);
 
         std::string characterName;
 
-        bool isCharacterAction = not(operationType == OperationEnum::INVALID or
-                                     operationType == OperationEnum::CAT_ACTION or
-                                     operationType == OperationEnum::JANITOR_ACTION);
-        if (isCharacterAction) {
-            auto characterOperation = std::dynamic_pointer_cast<const spy::gameplay::CharacterOperation>(op);
+        auto characterOperation = util::asCharacterOperation(*op);
+        if (characterOperation != nullptr) {
             auto executingCharInfo = std::find_if(characterInformation.begin(), characterInformation.end(),
                                                   [&characterOperation](const spy::character::CharacterInformation &ci) {
                                                       return characterOperation->getCharacterId() ==
@@ -306,112 +472,81 @@ namespace libclient {
             characterName = executingCharInfo->getName();
         }
 
-
-        switch (operationType) {
-            case OperationEnum::INVALID:
-                break;
-            case OperationEnum::GADGET_ACTION: {
-                auto gadgetOperation = std::dynamic_pointer_cast<const spy::gameplay::GadgetAction>(op);
-
-                auto gadgetType = gadgetOperation->getGadget();
-                nlohmann::json gadgetTypeJson = gadgetType;
-                std::string gadgetTypeStr = gadgetTypeJson.dump();
-                std::for_each(gadgetTypeStr.begin(), gadgetTypeStr.end(), [](char &c) {
-                    c = std::tolower(c);
-                });
-
-                auto targetCoords = gadgetOperation->getTarget();
-
-                operationString = "Gadget Op. " + gadgetTypeStr + " by " + characterName + " on x=" +
-                                  std::to_string(targetCoords.x) + " y=" + std::to_string(targetCoords.y);
-                break;
-            }
-            case OperationEnum::SPY_ACTION: {
-                auto spyOperation = std::dynamic_pointer_cast<const spy::gameplay::SpyAction>(op);
-
-                auto targetCoords = spyOperation->getTarget();
-
-                operationString =
-                        "Spy op. by " + characterName + " on x=" + std::to_string(targetCoords.x) + " y=" +
-                        std::to_string(targetCoords.y);
-                break;
-            }
-            case OperationEnum::GAMBLE_ACTION: {
-                auto gambleOperation = std::dynamic_pointer_cast<const spy::gameplay::GambleAction>(op);
-
-                auto targetCoords = gambleOperation->getTarget();
-
-                operationString =
-                        "Gamble op. by " + characterName + ", bet " + std::to_string(gambleOperation->getStake()) +
-                        " Chips on x=" + std::to_string(targetCoords.x) + " y=" + std::to_string(targetCoords.y);
-                break;
-            }
-            case OperationEnum::PROPERTY_ACTION: {
-                auto propertyOperation = std::dynamic_pointer_cast<const spy::gameplay::PropertyAction>(op);
-
-                nlohmann::json propertyJson = propertyOperation->getUsedProperty();
-                std::string propertyString = propertyJson.dump();
-                std::for_each(propertyString.begin(), propertyString.end(), [](char &c) {
-                    c = std::tolower(c);
-                });
-
-                auto targetCoords = propertyOperation->getTarget();
-
-                operationString =
-                        "Property op. by " + characterName + "on x=" + std::to_string(targetCoords.x) + " y=" +
-                        std::to_string(targetCoords.y);
-
-                break;
-            }
-            case OperationEnum::MOVEMENT: {
-                auto movementOperation = std::dynamic_pointer_cast<const spy::gameplay::Movement>(op);
-
-                auto from = movementOperation->getFrom();
-                auto to = movementOperation->getTarget();
-
-                operationString = "Movement op. by " + characterName + " from x=" + std::to_string(from.x) + " y=" +
-                                  std::to_string(from.y) + " to x=" + std::to_string(to.x) + " y=" +
-                                  std::to_string(to.y);
-                break;
-            }
-            case OperationEnum::CAT_ACTION: {
-                auto catOperation = std::dynamic_pointer_cast<const spy::gameplay::CatAction>(op);
-
-                operationString = "Cat. op on x=" + std::to_string(catOperation->getTarget().x) + " y=" +
-                                  std::to_string(catOperation->getTarget().y);
-                break;
-            }
-            case OperationEnum::JANITOR_ACTION: {
-                auto janitorOperation = std::dynamic_pointer_cast<const spy::gameplay::JanitorAction>(op);
-
-                operationString = "Janitor op on x=" + std::to_string(janitorOperation->getTarget().x) + " y=" +
-                                  std::to_string(janitorOperation->getTarget().y);
-                break;
-            }
-            case OperationEnum::EXFILTRATION: {
-                auto exfiltrationOperation = std::dynamic_pointer_cast<const spy::gameplay::Exfiltration>(op);
-
-                auto from = exfiltrationOperation->getFrom();
-                auto to = exfiltrationOperation->getTarget();
-
-                operationString = characterName + " was exfiltrated from x=" + std::to_string(from.x) + " y=" +
-                                  std::to_string(from.y) + " to x=" + std::to_string(to.x) + " y=" +
-                                  std::to_string(to.y);
-
-                break;
-            }
-            case OperationEnum::RETIRE: {
-                auto retireOperation = std::dynamic_pointer_cast<const spy::gameplay::RetireAction>(op);
-
-                auto target = retireOperation->getTarget();
-
-                operationString =
-                        characterName + " retired on x=" + std::to_string(target.x) + " y=" + std::to_string(target.y);
-                break;
-            }
-            default:
-                break;
-        }
+        util::visitOperation(*op, util::Overloaded{
+                [&operationString, &characterName](const spy::gameplay::GadgetAction &gadgetOperation) {
+                    auto gadgetType = gadgetOperation.getGadget();
+                    nlohmann::json gadgetTypeJson = gadgetType;
+                    std::string gadgetTypeStr = gadgetTypeJson.dump();
+                    std::for_each(gadgetTypeStr.begin(), gadgetTypeStr.end(), [](char &c) {
+                        c = std::tolower(c);
+                    });
+
+                    auto targetCoords = gadgetOperation.getTarget();
+
+                    operationString = "Gadget Op. " + gadgetTypeStr + " by " + characterName + " on x=" +
+                                      std::to_string(targetCoords.x) + " y=" + std::to_string(targetCoords.y);
+                },
+                [&operationString, &characterName](const spy::gameplay::SpyAction &spyOperation) {
+                    auto targetCoords = spyOperation.getTarget();
+
+                    operationString =
+                            "Spy op. by " + characterName + " on x=" + std::to_string(targetCoords.x) + " y=" +
+                            std::to_string(targetCoords.y);
+                },
+                [&operationString, &characterName](const spy::gameplay::GambleAction &gambleOperation) {
+                    auto targetCoords = gambleOperation.getTarget();
+
+                    operationString =
+                            "Gamble op. by " + characterName + ", bet " + std::to_string(gambleOperation.getStake()) +
+                            " Chips on x=" + std::to_string(targetCoords.x) + " y=" + std::to_string(targetCoords.y);
+                },
+                [&operationString, &characterName](const spy::gameplay::PropertyAction &propertyOperation) {
+                    nlohmann::json propertyJson = propertyOperation.getUsedProperty();
+                    std::string propertyString = propertyJson.dump();
+                    std::for_each(propertyString.begin(), propertyString.end(), [](char &c) {
+                        c = std::tolower(c);
+                    });
+
+                    auto targetCoords = propertyOperation.getTarget();
+
+                    operationString =
+                            "Property op. by " + characterName + "on x=" + std::to_string(targetCoords.x) + " y=" +
+                            std::to_string(targetCoords.y);
+                },
+                [&operationString, &characterName](const spy::gameplay::Movement &movementOperation) {
+                    auto from = movementOperation.getFrom();
+                    auto to = movementOperation.getTarget();
+
+                    operationString = "Movement op. by " + characterName + " from x=" + std::to_string(from.x) +
+                                      " y=" + std::to_string(from.y) + " to x=" + std::to_string(to.x) + " y=" +
+                                      std::to_string(to.y);
+                },
+                [&operationString](const spy::gameplay::CatAction &catOperation) {
+                    operationString = "Cat. op on x=" + std::to_string(catOperation.getTarget().x) + " y=" +
+                                      std::to_string(catOperation.getTarget().y);
+                },
+                [&operationString](const spy::gameplay::JanitorAction &janitorOperation) {
+                    operationString = "Janitor op on x=" + std::to_string(janitorOperation.getTarget().x) + " y=" +
+                                      std::to_string(janitorOperation.getTarget().y);
+                },
+                [&operationString, &characterName](const spy::gameplay::Exfiltration &exfiltrationOperation) {
+                    auto from = exfiltrationOperation.getFrom();
+                    auto to = exfiltrationOperation.getTarget();
+
+                    operationString = characterName + " was exfiltrated from x=" + std::to_string(from.x) + " y=" +
+                                      std::to_string(from.y) + " to x=" + std::to_string(to.x) + " y=" +
+                                      std::to_string(to.y);
+                },
+                [&operationString, &characterName](const spy::gameplay::RetireAction &retireOperation) {
+                    auto target = retireOperation.getTarget();
+
+                    operationString = characterName + " retired on x=" + std::to_string(target.x) + " y=" +
+                                      std::to_string(target.y);
+                },
+                [](const spy::gameplay::BaseOperation &) {
+                    // invalid operation
+                }
+        });
 
         return operationString;
     }
@@ -434,11 +569,7 @@ namespace libclient {
             model->aiState.properties[info.getCharacterId()] = info.getFeatures();
         }
 
-        // not nice but have to iterate over enum values
-        for (int gadgetType = 1; gadgetType < 22; gadgetType++) {
-            model->aiState.unknownGadgets[std::make_shared<spy::gadget::Gadget>(
-                    spy::gadget::GadgetEnum(gadgetType))];
-        }
+        model->aiState.addUnknownGadgets();
     }
 
     std::optional<spy::network::messages::Replay> LibClient::getReplay() const {
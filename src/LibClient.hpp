@@ -150,13 +150,218 @@ namespace libclient {
             hasCharacterGadget(const spy::util::UUID &id, spy::gadget::GadgetEnum type) const;
 
             /**
-             * calculate unique index for safe
-             * @param s current state
+             * get ownership distribution of all gadgets at once (instead of calling hasCharacterGadget for each pair)
+             * @return matrix gadget types x (characters + floor + unassigned), rows with information sum up to 1
+             */
+            [[nodiscard]] model::GadgetOwnership getGadgetOwnership() const;
+
+            /**
+             * set known sizes of the factions (e.g. from server configuration)
+             * size of own faction is ignored once it is known from the RequestEquipmentChoice message
+             * @param counts bounds for number of characters in my, enemy and npc faction
+             */
+            void setFactionCounts(const model::FactionCounts &counts);
+
+            /**
+             * get exact faction probabilities of all characters under the known faction sizes
+             * @return solution, factions are PLAYER1 for my, PLAYER2 for enemy and NEUTRAL for npc characters
+             */
+            [[nodiscard]] model::FactionSolution getFactionProbabilities() const;
+
+            /**
+             * get complete AIState, e.g. to draw determinizations with model::BeliefSampler
+             * @return AIState of the model
+             */
+            [[nodiscard]] const model::AIState &getAIState() const;
+
+            /**
+             * get movement distance between walkable fields (precomputed when HelloReply message was received)
+             * @param from start field
+             * @param to target field
+             * @return minimal number of steps, nullopt if not reachable
+             */
+            [[nodiscard]] std::optional<unsigned int> getDistance(const spy::util::Point &from,
+                                                                  const spy::util::Point &to) const;
+
+            /**
+             * get first step of a shortest path
+             * @param from start field
+             * @param to target field
+             * @return next field to move to, nullopt if not reachable
+             */
+            [[nodiscard]] std::optional<spy::util::Point> getNextStep(const spy::util::Point &from,
+                                                                      const spy::util::Point &to) const;
+
+            /**
+             * get distance cache of the level, e.g. for distances to fields next to safes or bar tables
+             * @return distance cache, built when HelloReply message was received
+             */
+            [[nodiscard]] const model::DistanceCache &getDistanceCache() const;
+
+            /**
+             * get bitboard layers of the current map (field types, fog, gadgets, occupied fields)
+             * @return bitboards, refreshed by every GameStatus message
+             */
+            [[nodiscard]] const model::Bitboards &getBitboards() const;
+
+            /**
+             * get fields a character can reach in the current state (cached until next GameStatus message)
+             * @param id id of the character
+             * @param movePoints movement budget, nullopt for the current movement points of the character
+             * @param passOccupied true if occupied fields can be entered (characters swap places), false to only pass
+             * free fields
+             * @return reachable fields with cheapest paths (model::Reachability::getPath), nullptr if character is
+             * not on the map, stays valid after the next GameStatus message (but is not updated)
+             */
+            [[nodiscard]] std::shared_ptr<const model::Reachability>
+            getReachableFields(const spy::util::UUID &id, std::optional<unsigned int> movePoints = std::nullopt,
+                               bool passOccupied = true) const;
+
+            /**
+             * check line of sight in current state (cached, characters are not taken into account)
+             * @param from field of the observer
+             * @param to target field
+             * @return true if to is in sight of from
+             */
+            [[nodiscard]] bool isInSight(const spy::util::Point &from, const spy::util::Point &to) const;
+
+            /**
+             * get fields in sight in current state, e.g. to enumerate gadget or observation targets
+             * @param from field of the observer
+             * @param range maximal distance (number of king moves), 0 for no limit
+             * @return fields in sight of from (cached, characters are not taken into account)
+             */
+            [[nodiscard]] std::vector<spy::util::Point>
+            getFieldsInSight(const spy::util::Point &from, unsigned int range = 0) const;
+
+            /**
+             * find character on field of current state in O(1)
+             * @param p position
+             * @return id of character on field, nullopt if field is empty
+             */
+            [[nodiscard]] std::optional<spy::util::UUID> getCharacterAt(const spy::util::Point &p) const;
+
+            /**
+             * find characters of current state near a field
+             * @param center center of the range
+             * @param distance maximal distance (number of king moves)
+             * @return ids of characters within distance to center
+             */
+            [[nodiscard]] std::vector<spy::util::UUID>
+            getCharactersInRange(const spy::util::Point &center, unsigned int distance) const;
+
+            /**
+             * calculate unique index for safe (index in the safe registry)
              * @param p position of the safe as Point
-             * @return index for the safe at position p
+             * @return index for the safe at position p, nullopt if safe registry is not built or there is no safe at p
+             */
+            [[nodiscard]] std::optional<unsigned int> safePosToIndex(const spy::util::Point &p) const;
+
+            /**
+             * calculate unique index for safe, kept for existing clients, use safePosToIndex(p) instead
+             * @param s current state (used to find the safes if the safe registry is not built yet)
+             * @param p position of the safe as Point
+             * @return index for the safe at position p, std::numeric_limits<unsigned int>::max() if there is no safe
              */
             unsigned int safePosToIndex(const spy::gameplay::State &s, const spy::util::Point &p) const;
 
+            /**
+             * get registry of all safes in the level (dense safe indices, positions, opened safes as bitsets)
+             * @return safe registry, built when HelloReply message was received
+             */
+            [[nodiscard]] const model::SafeRegistry &getSafeRegistry() const;
+
+            /**
+             * get all legal operations of the active character (cached until next request or GameStatus message)
+             * their validation results are cached, so sending one of them with getSettings does not validate again
+             * @return operations that pass the action validators, empty if no operation is requested
+             */
+            const std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> &getLegalOperations();
+
+            /**
+             * create simulator for lookahead search starting at the current state and beliefs
+             * @return simulator with own copy of state and AIState
+             */
+            [[nodiscard]] model::Simulator createSimulator() const;
+
+            /**
+             * chooses best legal operation of the active character by a root bandit within its budget
+             * @param service root bandit of the client (owns worker threads and evaluator)
+             * @return result, best operation can be sent with network.sendGameOperation
+             */
+            model::SearchResult search(model::RootBanditSearch &service);
+
+            /**
+             * get arrival time of the last RequestGameOperation message, e.g. to compute the remaining turn time
+             * @return time point, nullopt if no operation was requested yet
+             */
+            [[nodiscard]] const std::optional<std::chrono::steady_clock::time_point> &getOperationRequestTime() const;
+
+            /**
+             * get smoothed time from sending an operation until the GameStatus answer arrived
+             * @return round trip time in seconds (including processing of server), 0 if not measured yet
+             */
+            [[nodiscard]] double getRoundTripTime() const;
+
+            /**
+             * get time spent validating operations in sendGameOperation
+             * @return number of submissions, cache hits and validation time
+             */
+            [[nodiscard]] const model::ValidationStatistics &getValidationStatistics() const;
+
+            /**
+             * measure validation time of sendGameOperation without and with validation cache for all legal operations
+             * of the current request (nothing is sent)
+             * @param repetitions number of validations of every operation per path
+             * @return mean validation time per operation, empty if client is not allowed to make an operation
+             */
+            model::ValidationBenchmark benchmarkValidation(unsigned int repetitions = 100);
+
+            /**
+             * estimate memory held by the model, e.g. to plan how many clients fit on a host
+             * @return approximate bytes per component and number of operations and beliefs (walks all containers)
+             */
+            [[nodiscard]] model::MemoryUsage getMemoryUsage() const;
+
+            /**
+             * enable or disable tracking of the maximal memory usage, when enabled the model is measured after every
+             * received message
+             * @param enabled true to start tracking at the current usage, false to stop and reset the maximum
+             */
+            void setMemoryTracking(bool enabled);
+
+            /**
+             * get maximal memory usage of every component since tracking was enabled
+             * @return high water mark, all 0 if tracking is disabled
+             */
+            [[nodiscard]] const model::MemoryUsage &getMemoryPeak() const;
+
+            /**
+             * enable or disable counting of heap allocations per message type, received messages are counted from
+             * parsing until their callback returned, sent messages for the whole send method
+             * @param enabled true to start counting with empty statistics, false to stop (statistics are kept)
+             * @return false if LibClientAllocHook is not linked into the executable (only calls are counted)
+             */
+            bool setAllocationCounting(bool enabled);
+
+            /**
+             * @return allocation statistics per type of received message since counting was enabled
+             */
+            [[nodiscard]] std::map<spy::network::messages::MessageTypeEnum, util::AllocationStatistics>
+            getReceivedAllocations() const;
+
+            /**
+             * @return allocation statistics per type of sent message since counting was enabled
+             */
+            [[nodiscard]] std::map<spy::network::messages::MessageTypeEnum, util::AllocationStatistics>
+            getSentAllocations() const;
+
+            /**
+             * get ranked safes to open and npcs to spy on for safe combinations
+             * @return plan, only recomputed if combinations, safes or character positions changed
+             */
+            const model::SafePlan &getSafePlan();
+
             [[nodiscard]] const std::set<unsigned int> &getOpenedSafes() const;
 
             [[nodiscard]] const std::map<unsigned int, int> &getTriedSafes() const;
@@ -30,220 +30,295 @@
 #include <network/messages/Strike.hpp>
 #include <network/messages/MetaInformation.hpp>
 #include <util/UUID.hpp>
+#include <util/AllocationCounter.hpp>
 #include <utility>
+#include <chrono>
 
 namespace libclient {
+    namespace {
+        /**
+         * records allocations of the calling thread from construction to destruction for a message type if counting
+         * is enabled, keeps the model alive in case it is replaced meanwhile (e.g. by disconnect in a callback)
+         */
+        class AllocationRecorder {
+            public:
+                AllocationRecorder(const std::shared_ptr<Model> &m, bool isReceived,
+                                   std::optional<spy::network::messages::MessageTypeEnum> messageType = std::nullopt)
+                        : model(m->countAllocations ? m : nullptr), received(isReceived), type(messageType) {}
+
+                AllocationRecorder(const AllocationRecorder &) = delete;
+
+                AllocationRecorder &operator=(const AllocationRecorder &) = delete;
+
+                ~AllocationRecorder() {
+                    if (model != nullptr && type.has_value()) {
+                        auto count = scope.get();
+                        auto &registry = received ? model->receivedAllocations : model->sentAllocations;
+                        registry.record(type.value(), count);
+                    }
+                }
+
+                void setType(spy::network::messages::MessageTypeEnum messageType) {
+                    type = messageType;
+                }
+
+            private:
+                std::shared_ptr<Model> model;
+                bool received;
+                std::optional<spy::network::messages::MessageTypeEnum> type;
+                util::AllocationScope scope;
+        };
+    }
+
     Network::Network(libclient::Callback *c, std::shared_ptr<Model> m) : callback(c), model(std::move(m)) {}
 
     void Network::onReceiveMessage(const std::string &message) {
+        auto received = std::chrono::steady_clock::now();
+        AllocationRecorder recorder(model, true);
         auto json = nlohmann::json::parse(message);
         auto mc = json.get<spy::network::MessageContainer>();
+        recorder.setType(mc.getType());
+
+        // model is written under modelMutex, callback is called afterwards without it (it may join threads that
+        // wait for the lock, e.g. DecisionScheduler::cancel) and takes it itself before it accesses the model
+        void (Callback::*notify)() = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(modelMutex);
+            model->clientState.debugMessage = mc.getDebugMessage();
+
+            if (model->clientState.id.has_value() && model->clientState.id.value() != mc.getClientId()) {
+                // received message that was not for this client
+                notify = &Callback::wrongDestination;
+            } else {
+                switch (mc.getType()) {
+                    case spy::network::messages::MessageTypeEnum::HELLO_REPLY: {
+                        model->clientState.id = mc.getClientId();
+                        auto m = json.get<spy::network::messages::HelloReply>();
+                        model->clientState.sessionId = m.getSessionId();
+                        model->gameState.level = m.getLevel();
+                        model->gameState.settings = m.getSettings();
+                        model->gameState.characterSettings = m.getCharacterSettings();
+                        model->aiState.safes.build(model->gameState.level);
+                        model->gameState.distances.build(model->gameState.level, true);
+
+                        for (const auto &info: model->gameState.characterSettings) {
+                            model->aiState.unknownFaction[info.getCharacterId()];
+                            model->aiState.properties[info.getCharacterId()] = info.getFeatures();
+                        }
 
-        model->clientState.debugMessage = mc.getDebugMessage();
+                        model->aiState.addUnknownGadgets();
 
-        if (model->clientState.id.has_value() && model->clientState.id.value() != mc.getClientId()) {
-            // received message that was not for this client
-            callback->wrongDestination();
-            return;
-        }
+                        state = NetworkState::WELCOMED;
+                        notify = &Callback::onHelloReply;
+                        break;
+                    }
+                    case spy::network::messages::MessageTypeEnum::GAME_STARTED: {
+                        auto m = json.get<spy::network::messages::GameStarted>();
+                        if (model->clientState.sessionId != m.getSessionId()) {
+                            // received message that was not for this session
+                            notify = &Callback::wrongDestination;
+                            break;
+                        }
+                        model->clientState.playerOneId = m.getPlayerOneId();
+                        model->clientState.playerTwoId = m.getPlayerTwoId();
+                        model->clientState.playerOneName = m.getPlayerOneName();
+                        model->clientState.playerTwoName = m.getPlayerTwoName();
+
+                        state = NetworkState::IN_GAME;
+                        notify = &Callback::onGameStarted;
+                        break;
+                    }
+                    case spy::network::messages::MessageTypeEnum::REQUEST_ITEM_CHOICE: {
+                        auto m = json.get<spy::network::messages::RequestItemChoice>();
+                        model->gameState.offeredCharacters = m.getOfferedCharacterIds();
+                        model->gameState.offeredGadgets = m.getOfferedGadgets();
+
+                        state = NetworkState::IN_ITEMCHOICE;
+                        notify = &Callback::onRequestItemChoice;
+                        break;
+                    }
+                    case spy::network::messages::MessageTypeEnum::REQUEST_EQUIPMENT_CHOICE: {
+                        auto m = json.get<spy::network::messages::RequestEquipmentChoice>();
+                        model->gameState.chosenCharacter = m.getChosenCharacterIds();
+                        model->gameState.chosenGadget = m.getChosenGadgets();
 
-        switch (mc.getType()) {
-            case spy::network::messages::MessageTypeEnum::HELLO_REPLY: {
-                model->clientState.id = mc.getClientId();
-                auto m = json.get<spy::network::messages::HelloReply>();
-                model->clientState.sessionId = m.getSessionId();
-                model->gameState.level = m.getLevel();
-                model->gameState.settings = m.getSettings();
-                model->gameState.characterSettings = m.getCharacterSettings();
+                        for (const auto c: model->gameState.chosenCharacter) {
+                            model->aiState.addFaction(c, model->aiState.myFaction);
+                        }
+                        auto numberOfMyCharacters = static_cast<unsigned int>(model->gameState.chosenCharacter.size());
+                        model->aiState.factionCounts.my = {numberOfMyCharacters, numberOfMyCharacters};
 
-                for (const auto &info: model->gameState.characterSettings) {
-                    model->aiState.unknownFaction[info.getCharacterId()];
-                    model->aiState.properties[info.getCharacterId()] = info.getFeatures();
-                }
+                        state = NetworkState::IN_EQUIPMENTCHOICE;
+                        notify = &Callback::onRequestEquipmentChoice;
+                        break;
+                    }
+                    case spy::network::messages::MessageTypeEnum::GAME_STATUS: {
+                        auto m = json.get<spy::network::messages::GameStatus>();
+                        if (model->clientState.operationSent.has_value()) {
+                            // answer to own operation -> sample of round trip time (including server processing)
+                            std::chrono::duration<double> sample = received - model->clientState.operationSent.value();
+                            auto &rtt = model->clientState.roundTripTime;
+                            rtt = rtt > 0 ? 0.8 * rtt + 0.2 * sample.count() : sample.count();
+                            model->clientState.operationSent.reset();
+                        }
+                        model->gameState.lastActiveCharacter = m.getActiveCharacterId();
+                        model->gameState.operations.reserve(model->gameState.operations.size() +
+                                                            m.getOperations().size());
+                        for (const auto &op: m.getOperations()) {
+                            model->gameState.operations.push_back(op->clone());
+                        }
+                        model->gameState.characterGrid.build(m.getState());
+                        model->gameState.handleLastClientOperation(m.getState());
+                        model->gameState.isGameOver = m.getIsGameOver();
+
+                        // update AIState for each operation
+                        if (model->clientState.role != spy::network::RoleEnum::SPECTATOR) {
+                            auto myFaction = model->clientState.amIPlayer1() ? spy::character::FactionEnum::PLAYER1
+                                                                             : spy::character::FactionEnum::PLAYER2;
+                            // sure information is applied once to the new state below
+                            model->aiState.processOperations(m.getOperations(), model->gameState.state,
+                                                             model->gameState.settings, myFaction);
+                            model->aiState.propagateFactionConstraints();
+                        }
 
-                // not nice but have to iterate over enum values
-                for (int gadgetType = 1; gadgetType < 22; gadgetType++) {
-                    model->aiState.unknownGadgets[std::make_shared<spy::gadget::Gadget>(
-                            spy::gadget::GadgetEnum(gadgetType))];
-                }
+                        // set current state and merge AIState into
+                        // (copy keeps character order -> characterGrid stays valid)
+                        model->gameState.state = m.getState();
+                        model->gameState.stateVersion++;
 
-                state = NetworkState::WELCOMED;
-                callback->onHelloReply();
-                break;
-            }
-            case spy::network::messages::MessageTypeEnum::GAME_STARTED: {
-                auto m = json.get<spy::network::messages::GameStarted>();
-                if (model->clientState.sessionId != m.getSessionId()) {
-                    // received message that was not for this session
-                    callback->wrongDestination();
-                    return;
-                }
-                model->clientState.playerOneId = m.getPlayerOneId();
-                model->clientState.playerTwoId = m.getPlayerTwoId();
-                model->clientState.playerOneName = m.getPlayerOneName();
-                model->clientState.playerTwoName = m.getPlayerTwoName();
-
-                state = NetworkState::IN_GAME;
-                callback->onGameStarted();
-                break;
-            }
-            case spy::network::messages::MessageTypeEnum::REQUEST_ITEM_CHOICE: {
-                auto m = json.get<spy::network::messages::RequestItemChoice>();
-                model->gameState.offeredCharacters = m.getOfferedCharacterIds();
-                model->gameState.offeredGadgets = m.getOfferedGadgets();
-
-                state = NetworkState::IN_ITEMCHOICE;
-                callback->onRequestItemChoice();
-                break;
-            }
-            case spy::network::messages::MessageTypeEnum::REQUEST_EQUIPMENT_CHOICE: {
-                auto m = json.get<spy::network::messages::RequestEquipmentChoice>();
-                model->gameState.chosenCharacter = m.getChosenCharacterIds();
-                model->gameState.chosenGadget = m.getChosenGadgets();
+                        // destroyed walls change paths, walls and fog change sight
+                        auto destroyedWalls = model->gameState.distances.update(model->gameState.state);
+                        if (destroyedWalls > 0) {
+                            model->safePlanner.invalidate();
+                        }
+                        model->gameState.lineOfSight.update(model->gameState.state);
+                        model->gameState.bitboards.update(model->gameState.state);
+                        model->gameState.reachability.clear();
+
+                        // check for gadgets that are on the floor
+                        // (destroyed walls are free fields that can hold gadgets now)
+                        auto &floorGadgets = model->gameState.floorGadgets;
+                        floorGadgets.update(model->gameState.state, destroyedWalls > 0);
+                        for (auto type: floorGadgets.getGadgetTypes()) {
+                            if (type != spy::gadget::GadgetEnum::COCKTAIL && !model->aiState.isGadgetOnFloor(type)) {
+                                model->aiState.addGadget(type, std::nullopt);
+                            }
+                        }
 
-                for (const auto c: model->gameState.chosenCharacter) {
-                    model->aiState.addFaction(c, model->aiState.myFaction);
-                }
+                        if (model->clientState.role != spy::network::RoleEnum::SPECTATOR) {
+                            auto myFaction = model->clientState.amIPlayer1() ? spy::character::FactionEnum::PLAYER1
+                                                                             : spy::character::FactionEnum::PLAYER2;
+                            model->aiState.applySureInformation(model->gameState.state, myFaction);
+                        }
 
-                state = NetworkState::IN_EQUIPMENTCHOICE;
-                callback->onRequestEquipmentChoice();
-                break;
-            }
-            case spy::network::messages::MessageTypeEnum::GAME_STATUS: {
-                auto m = json.get<spy::network::messages::GameStatus>();
-                model->gameState.lastActiveCharacter = m.getActiveCharacterId();
-                model->gameState.operations.reserve(model->gameState.operations.size() + m.getOperations().size());
-                for (const auto &op: m.getOperations()) {
-                    model->gameState.operations.push_back(op->clone());
-                }
-                model->gameState.handleLastClientOperation(m.getState());
-                model->gameState.isGameOver = m.getIsGameOver();
-
-                // update AIState for each operation
-                if (model->clientState.role != spy::network::RoleEnum::SPECTATOR) {
-                    auto myFaction = model->clientState.amIPlayer1() ? spy::character::FactionEnum::PLAYER1
-                                                                     : spy::character::FactionEnum::PLAYER2;
-                    for (const auto &op: m.getOperations()) {
-                        model->aiState.processOperation(op, model->gameState.state, model->gameState.settings, myFaction);
-                        model->aiState.applySureInformation(model->gameState.state, myFaction);
+                        state = m.getIsGameOver() ? NetworkState::GAME_OVER : NetworkState::IN_GAME;
+                        notify = &Callback::onGameStatus;
+                        break;
                     }
-                }
+                    case spy::network::messages::MessageTypeEnum::REQUEST_GAME_OPERATION: {
+                        model->clientState.operationRequested = received;
+                        auto m = json.get<spy::network::messages::RequestGameOperation>();
+                        model->clientState.activeCharacter = m.getCharacterId();
+                        model->operationGenerator.invalidate();
+
+                        state = NetworkState::IN_GAME_ACTIVE;
+                        notify = &Callback::onRequestGameOperation;
+                        break;
+                    }
+                    case spy::network::messages::MessageTypeEnum::STATISTICS: {
+                        auto m = json.get<spy::network::messages::StatisticsMessage>();
+                        model->gameState.winner = m.getWinner();
+                        model->gameState.winningReason = m.getReason();
+                        model->gameState.statistics = m.getStatistics();
+                        model->gameState.hasReplay = m.getHasReplay();
+
+                        state = NetworkState::GAME_OVER;
+                        notify = &Callback::onStatistics;
+                        break;
+                    }
+                    case spy::network::messages::MessageTypeEnum::GAME_LEFT: {
+                        auto m = json.get<spy::network::messages::GameLeft>();
+                        model->clientState.leftUserId = m.getLeftUserId();
 
-                // set current state and merge AIState into
-                model->gameState.state = m.getState();
-
-                // check for gadgets that are on the floor
-                const auto &mo = model;
-                auto map = model->gameState.state.getMap();
-                for (auto y = 0U; y < map.getMap().size(); y++) {
-                    for (auto x = 0U; x < map.getMap().at(y).size(); x++) {
-                        auto field = map.getField(x, y);
-                        auto gad = field.getGadget();
-                        if (gad.has_value() && gad.value()->getType() != spy::gadget::GadgetEnum::COCKTAIL) {
-                            mo->aiState.addGadget(gad.value()->getType(), std::nullopt);
+                        state = NetworkState::GAME_OVER;
+                        notify = &Callback::onGameLeft;
+                        break;
+                    }
+                    case spy::network::messages::MessageTypeEnum::GAME_PAUSE: {
+                        auto m = json.get<spy::network::messages::GamePause>();
+                        model->clientState.gamePaused = m.isGamePause();
+                        model->clientState.serverEnforced = m.isServerEnforced();
+
+                        if (m.isGamePause()) {
+                            stateBeforePause = state;
+                            state = NetworkState::PAUSE;
+                        } else {
+                            state = stateBeforePause;
                         }
+                        notify = &Callback::onGamePause;
+                        break;
                     }
-                }
+                    case spy::network::messages::MessageTypeEnum::META_INFORMATION: {
+                        auto m = json.get<spy::network::messages::MetaInformation>();
+                        model->clientState.information = m.getInformation();
 
-                if (model->clientState.role != spy::network::RoleEnum::SPECTATOR) {
-                    auto myFaction = model->clientState.amIPlayer1() ? spy::character::FactionEnum::PLAYER1
-                                                                     : spy::character::FactionEnum::PLAYER2;
-                    model->aiState.applySureInformation(model->gameState.state, myFaction);
-                }
+                        notify = &Callback::onMetaInformation;
+                        break;
+                    }
+                    case spy::network::messages::MessageTypeEnum::STRIKE: {
+                        auto m = json.get<spy::network::messages::Strike>();
+                        model->clientState.strikeNr = m.getStrikeNr();
+                        model->clientState.strikeMax = m.getStrikeMax();
+                        model->clientState.strikeReason = m.getReason();
+
+                        if (state == NetworkState::SENT_HELLO) {
+                            state = NetworkState::CONNECTED;
+                        }
 
-                state = m.getIsGameOver() ? NetworkState::GAME_OVER : NetworkState::IN_GAME;
-                callback->onGameStatus();
-                break;
-            }
-            case spy::network::messages::MessageTypeEnum::REQUEST_GAME_OPERATION: {
-                auto m = json.get<spy::network::messages::RequestGameOperation>();
-                model->clientState.activeCharacter = m.getCharacterId();
+                        notify = &Callback::onStrike;
+                        break;
+                    }
+                    case spy::network::messages::MessageTypeEnum::ERROR: {
+                        auto m = json.get<spy::network::messages::Error>();
+                        model->clientState.errorReason = m.getReason();
 
-                state = NetworkState::IN_GAME_ACTIVE;
-                callback->onRequestGameOperation();
-                break;
-            }
-            case spy::network::messages::MessageTypeEnum::STATISTICS: {
-                auto m = json.get<spy::network::messages::StatisticsMessage>();
-                model->gameState.winner = m.getWinner();
-                model->gameState.winningReason = m.getReason();
-                model->gameState.statistics = m.getStatistics();
-                model->gameState.hasReplay = m.getHasReplay();
-
-                state = NetworkState::GAME_OVER;
-                callback->onStatistics();
-                break;
-            }
-            case spy::network::messages::MessageTypeEnum::GAME_LEFT: {
-                auto m = json.get<spy::network::messages::GameLeft>();
-                model->clientState.leftUserId = m.getLeftUserId();
+                        if (state == NetworkState::SENT_HELLO) {
+                            state = NetworkState::CONNECTED;
+                        }
 
-                state = NetworkState::GAME_OVER;
-                callback->onGameLeft();
-                break;
-            }
-            case spy::network::messages::MessageTypeEnum::GAME_PAUSE: {
-                auto m = json.get<spy::network::messages::GamePause>();
-                model->clientState.gamePaused = m.isGamePause();
-                model->clientState.serverEnforced = m.isServerEnforced();
-
-                if (m.isGamePause()) {
-                    stateBeforePause = state;
-                    state = NetworkState::PAUSE;
-                } else {
-                    state = stateBeforePause;
-                }
-                callback->onGamePause();
-                break;
-            }
-            case spy::network::messages::MessageTypeEnum::META_INFORMATION: {
-                auto m = json.get<spy::network::messages::MetaInformation>();
-                model->clientState.information = m.getInformation();
+                        notify = &Callback::onError;
+                        break;
+                    }
+                    case spy::network::messages::MessageTypeEnum::REPLAY: {
+                        auto m = json.get<spy::network::messages::Replay>();
+                        if (model->clientState.sessionId != m.getSessionId()) {
+                            // received message that was not for this session
+                            notify = &Callback::wrongDestination;
+                            break;
+                        }
+                        model->replay = m;
+                        // received once, measured here instead of serializing it again per measurement
+                        model->replaySize = sizeof(spy::network::messages::Replay) + message.size();
 
-                callback->onMetaInformation();
-                break;
-            }
-            case spy::network::messages::MessageTypeEnum::STRIKE: {
-                auto m = json.get<spy::network::messages::Strike>();
-                model->clientState.strikeNr = m.getStrikeNr();
-                model->clientState.strikeMax = m.getStrikeMax();
-                model->clientState.strikeReason = m.getReason();
-
-                if (state == NetworkState::SENT_HELLO) {
-                    state = NetworkState::CONNECTED;
+                        state = NetworkState::GAME_OVER;
+                        notify = &Callback::onReplay;
+                        break;
+                    }
+                    default:
+                        // do nothing
+                        notify = &Callback::wrongDestination;
+                        break;
                 }
-
-                callback->onStrike();
-                break;
             }
-            case spy::network::messages::MessageTypeEnum::ERROR: {
-                auto m = json.get<spy::network::messages::Error>();
-                model->clientState.errorReason = m.getReason();
 
-                if (state == NetworkState::SENT_HELLO) {
-                    state = NetworkState::CONNECTED;
-                }
-
-                callback->onError();
-                break;
+            if (model->trackMemory) {
+                model->memoryPeak.updateMaximum(model::measureMemoryUsage(*model));
             }
-            case spy::network::messages::MessageTypeEnum::REPLAY: {
-                auto m = json.get<spy::network::messages::Replay>();
-                if (model->clientState.sessionId != m.getSessionId()) {
-                    // received message that was not for this session
-                    callback->wrongDestination();
-                    return;
-                }
-                model->replay = m;
+        }
 
-                state = NetworkState::GAME_OVER;
-                callback->onReplay();
-                break;
-            }
-            default:
-                // do nothing
-                callback->wrongDestination();
-                break;
+        if (notify != nullptr) {
+            // not under modelMutex, see lockModel
+            (callback->*notify)();
         }
     }
 
@@ -321,6 +396,10 @@ namespace libclient {
         callback->connectionLost();
     }
 
+    std::unique_lock<std::mutex> Network::lockModel() {
+        return std::unique_lock<std::mutex>(modelMutex);
+    }
+
     void Network::disconnect() {
         if (webSocketClient.has_value()) {
             webSocketClient.reset();
@@ -330,6 +409,7 @@ namespace libclient {
     }
 
     bool Network::sendHello(const std::string &name, spy::network::RoleEnum role) {
+        AllocationRecorder recorder(model, false, spy::network::messages::MessageTypeEnum::HELLO);
         auto message = spy::network::messages::Hello(spy::util::UUID(), name, role);
         if (!message.validate() || state != NetworkState::CONNECTED) {
             return false;
@@ -343,6 +423,7 @@ namespace libclient {
     }
 
     bool Network::sendItemChoice(std::variant<spy::util::UUID, spy::gadget::GadgetEnum> choice) {
+        AllocationRecorder recorder(model, false, spy::network::messages::MessageTypeEnum::ITEM_CHOICE);
         if (state != NetworkState::IN_ITEMCHOICE) {
             return false;
         }
@@ -357,6 +438,7 @@ namespace libclient {
     }
 
     bool Network::sendEquipmentChoice(const std::map<spy::util::UUID, std::set<spy::gadget::GadgetEnum>> &equipment) {
+        AllocationRecorder recorder(model, false, spy::network::messages::MessageTypeEnum::EQUIPMENT_CHOICE);
         if (state != NetworkState::IN_EQUIPMENTCHOICE) {
             return false;
         }
@@ -380,20 +462,102 @@ namespace libclient {
 
     bool Network::sendGameOperation(const std::shared_ptr<spy::gameplay::BaseOperation> &operation,
                                     const spy::MatchConfig &config) {
+        AllocationRecorder recorder(model, false, spy::network::messages::MessageTypeEnum::GAME_OPERATION);
         if (state != NetworkState::IN_GAME_ACTIVE) {
             return false;
         }
         auto message = spy::network::messages::GameOperation(model->clientState.id.value(), operation);
-        if (!message.validate(model->clientState.role, model->gameState.state, model->clientState.activeCharacter,
-                              config)) {
+
+        auto start = std::chrono::steady_clock::now();
+        auto [valid, cacheHit] = validateGameOperation(operation, config);
+        std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+        model->validationCache.recordSubmission(duration.count(), cacheHit);
+
+        if (!valid) {
             return false;
         }
         nlohmann::json j = message;
         webSocketClient->send(j.dump());
+        model->clientState.operationSent = std::chrono::steady_clock::now();
         return true;
     }
 
+    void Network::cacheValidation(const std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> &operations) {
+        if (state != NetworkState::IN_GAME_ACTIVE) {
+            return;
+        }
+        for (const auto &operation: operations) {
+            validateGameOperation(operation, model->gameState.settings);
+        }
+    }
+
+    std::pair<bool, bool>
+    Network::validateGameOperation(const std::shared_ptr<spy::gameplay::BaseOperation> &operation,
+                                   const spy::MatchConfig &config) {
+        const auto &client = model->clientState;
+        auto validate = [this, &operation, &client, &config]() {
+            auto message = spy::network::messages::GameOperation(client.id.value(), operation);
+            return message.validate(client.role, model->gameState.state, client.activeCharacter, config);
+        };
+        // config is not part of the key, results are only valid for the config of the model
+        if (&config != &model->gameState.settings) {
+            return {validate(), false};
+        }
+
+        auto &cache = model->validationCache;
+        auto key = model::ValidationCache::makeKey(*operation);
+        auto version = model->gameState.stateVersion;
+        if (auto cached = cache.lookup(key, version, client.activeCharacter, client.role)) {
+            return {cached.value(), true};
+        }
+        bool valid = validate();
+        cache.store(key, valid, version, client.activeCharacter, client.role);
+        return {valid, false};
+    }
+
+    model::ValidationBenchmark Network::benchmarkValidation(unsigned int repetitions) {
+        model::ValidationBenchmark result;
+        if (state != NetworkState::IN_GAME_ACTIVE || repetitions == 0) {
+            return result;
+        }
+        const auto &client = model->clientState;
+        const auto &operations = model->operationGenerator.generate(model->gameState, client);
+        auto version = model->gameState.stateVersion;
+        auto &cache = model->validationCache;
+        cacheValidation(operations);
+
+        std::chrono::duration<double> uncached{0};
+        std::chrono::duration<double> cached{0};
+        for (unsigned int r = 0; r < repetitions; r++) {
+            for (const auto &operation: operations) {
+                auto start = std::chrono::steady_clock::now();
+                auto message = spy::network::messages::GameOperation(client.id.value(), operation);
+                bool valid = message.validate(client.role, model->gameState.state, client.activeCharacter,
+                                              model->gameState.settings);
+                auto middle = std::chrono::steady_clock::now();
+                auto hit = cache.lookup(model::ValidationCache::makeKey(*operation), version, client.activeCharacter,
+                                        client.role);
+                auto end = std::chrono::steady_clock::now();
+                uncached += middle - start;
+                cached += end - middle;
+                if (r == 0 && (!valid || !hit.value_or(false))) {
+                    result.mismatches++;
+                }
+            }
+        }
+
+        result.operations = operations.size();
+        result.repetitions = repetitions;
+        auto validations = static_cast<double>(operations.size()) * static_cast<double>(repetitions);
+        if (validations > 0) {
+            result.uncachedSeconds = uncached.count() / validations;
+            result.cachedSeconds = cached.count() / validations;
+        }
+        return result;
+    }
+
     bool Network::sendGameLeave() {
+        AllocationRecorder recorder(model, false, spy::network::messages::MessageTypeEnum::GAME_LEAVE);
         if (state == NetworkState::NOT_CONNECTED || state == NetworkState::CONNECTED ||
             state == NetworkState::SENT_HELLO || state == NetworkState::RECONNECT) {
             return false;
@@ -408,6 +572,7 @@ namespace libclient {
     }
 
     bool Network::sendRequestGamePause(bool gamePause) {
+        AllocationRecorder recorder(model, false, spy::network::messages::MessageTypeEnum::REQUEST_GAME_PAUSE);
         if (state != NetworkState::IN_GAME && state != NetworkState::IN_GAME_ACTIVE && state != NetworkState::PAUSE) {
             return false;
         }
@@ -422,6 +587,7 @@ namespace libclient {
     }
 
     bool Network::sendRequestMetaInformation(std::vector<spy::network::messages::MetaInformationKey> keys) {
+        AllocationRecorder recorder(model, false, spy::network::messages::MessageTypeEnum::REQUEST_META_INFORMATION);
         if (state == NetworkState::NOT_CONNECTED || state == NetworkState::CONNECTED ||
             state == NetworkState::SENT_HELLO || state == NetworkState::RECONNECT) {
             return false;
@@ -436,6 +602,7 @@ namespace libclient {
     }
 
     bool Network::sendRequestReplayMessage() {
+        AllocationRecorder recorder(model, false, spy::network::messages::MessageTypeEnum::REQUEST_REPLAY);
         if (state != NetworkState::GAME_OVER) {
             return false;
         }
@@ -449,6 +616,7 @@ namespace libclient {
     }
 
     bool Network::sendReconnect() {
+        AllocationRecorder recorder(model, false, spy::network::messages::MessageTypeEnum::RECONNECT);
         if (state != NetworkState::RECONNECT) {
             return false;
         }
@@ -11,6 +11,7 @@
 #define LIBCLIENT_NETWORK_HPP
 
 #include <memory>
+#include <mutex>
 #include <variant>
 #include <Callback.hpp>
 #include <model/Model.hpp>
@@ -77,6 +78,16 @@ namespace libclient {
              */
             bool connect(const std::string &servername, int port);
 
+            /**
+             * locks the model, the network thread processes every received message under this lock and calls the
+             * callback after releasing it (so a callback can join threads that wait for the lock)
+             * as soon as more than one thread uses the client (e.g. DecisionScheduler and its evaluators), every access
+             * to the model through LibClient or this class has to hold it, including accesses from callbacks, which
+             * have to take it themselves (e.g. around getLegalOperations or sendGameOperation)
+             * @return lock, should be held only briefly as the next message waits for it
+             */
+            [[nodiscard]] std::unique_lock<std::mutex> lockModel();
+
             /**
              * disconnect from server, model is reset (can be called any time, e.g. to force connect method to work)
              */
@@ -88,9 +99,28 @@ namespace libclient {
 
             bool sendEquipmentChoice(const std::map<spy::util::UUID, std::set<spy::gadget::GadgetEnum>> &equipment);
 
+            /**
+             * validation results for the match config of the model (LibClient::getSettings) are cached until the
+             * next GameStatus message, other configs are validated on every call
+             */
             bool sendGameOperation(const std::shared_ptr<spy::gameplay::BaseOperation> &operation,
                                    const spy::MatchConfig &config);
 
+            /**
+             * validates operations with the match config of the model and caches the results, so sending one of
+             * them later is a cache lookup
+             * @param operations operations of the active character (e.g. from OperationGenerator)
+             */
+            void cacheValidation(const std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> &operations);
+
+            /**
+             * measures validation latency of sendGameOperation for all legal operations of the current request
+             * without and with validation cache (nothing is sent), e.g. to compare both paths on a live match
+             * @param repetitions number of validations of every operation per path
+             * @return mean validation time per operation, empty if no operation is requested
+             */
+            model::ValidationBenchmark benchmarkValidation(unsigned int repetitions);
+
             bool sendGameLeave();
 
             bool sendRequestGamePause(bool gamePause);
@@ -104,6 +134,7 @@ namespace libclient {
         private:
             Callback *callback;
             std::shared_ptr<Model> model;
+            std::mutex modelMutex; // see lockModel
             std::optional<websocket::network::WebSocketClient> webSocketClient;
             NetworkState state = NetworkState::NOT_CONNECTED;
             NetworkState stateBeforePause;
@@ -111,6 +142,15 @@ namespace libclient {
             std::string serverName;
             int serverPort;
 
+            /**
+             * runs GameOperation::validate, results for the match config of the model are cached
+             * @param operation operation of the active character
+             * @param config match config to validate with
+             * @return validation result and true if it was answered by the cache
+             */
+            std::pair<bool, bool> validateGameOperation(const std::shared_ptr<spy::gameplay::BaseOperation> &operation,
+                                                        const spy::MatchConfig &config);
+
             /**
              * function to handle received messages
              * @param message std::string received message from server
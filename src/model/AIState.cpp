@@ -7,57 +7,59 @@
 #include <datatypes/gameplay/PropertyAction.hpp>
 #include <datatypes/gameplay/SpyAction.hpp>
 #include <util/GameLogicUtils.hpp>
+#include <util/OperationDispatch.hpp>
+#include <util/AllocationCounter.hpp>
+#include <util/GadgetKeys.hpp>
+#include <chrono>
+#include <numeric>
 
 
 namespace libclient::model {
     void AIState::applySureInformation(spy::gameplay::State &s, spy::character::FactionEnum me) {
         using namespace spy::character;
 
-        auto handleFaction = [](const std::set<spy::util::UUID> &list, FactionEnum faction,
-                                spy::character::Character &c) {
-            auto it = std::find(list.begin(), list.end(), c.getCharacterId());
-            if (it != list.end()) {
-                c.setFaction(faction);
-                return true;
-            }
-            return false;
-        };
+        // state may hold gadgets AIState does not know yet
+        takeGadgetsFromState(s);
 
-        for (auto &c: s.getCharacters()) {
-            // faction
-            if (handleFaction(npcFaction, FactionEnum::NEUTRAL, c)) {
-                continue;
-            }
-            if (handleFaction(myFaction, me, c)) {
-                continue;
-            }
-            if (handleFaction(enemyFaction, me == FactionEnum::PLAYER1 ? FactionEnum::PLAYER2 : FactionEnum::PLAYER1,
-                              c)) {
-                continue;
-            }
+        auto enemy = me == FactionEnum::PLAYER1 ? FactionEnum::PLAYER2 : FactionEnum::PLAYER1;
+        auto applyCharacter = [this, me, enemy](spy::character::Character &c) {
+            const auto &id = c.getCharacterId();
 
-            // properties
-            if (c.getFaction() != me) {
-                c.setProperties(properties[c.getCharacterId()]);
+            // faction
+            if (npcFaction.find(id) != npcFaction.end()) {
+                c.setFaction(FactionEnum::NEUTRAL);
+            } else if (myFaction.find(id) != myFaction.end()) {
+                c.setFaction(me);
+            } else if (enemyFaction.find(id) != enemyFaction.end()) {
+                c.setFaction(enemy);
+            } else if (c.getFaction() != me) {
+                // properties
+                if (properties.find(id) == properties.end()) {
+                    saveEntry(&AIState::properties, id);
+                }
+                c.setProperties(properties[id]);
             }
-        }
+        };
 
-        // apply characterGadgets from state
-        auto copyCharacterGadgets = characterGadgets;
-        for (const auto &it : copyCharacterGadgets) {
-            auto c = s.getCharacters().getByUUID(it.second);
-            for (const auto &gad: c->getGadgets()) {
-                addGadgetToCharacter(gad, c->getCharacterId());
-            }
+        // all characters of the state, also the ones that are in no faction list
+        for (auto &c: s.getCharacters()) {
+            applyCharacter(c);
         }
 
         // gadgets
-        for (const auto &it : characterGadgets) {
-            auto c = s.getCharacters().getByUUID(it.second);
-            if (c->getFaction() != me && !c->hasGadget(it.first->getType())) {
-                c->addGadget(it.first);
+        auto applyGadget = [&s, me](const std::shared_ptr<spy::gadget::Gadget> &gad, const spy::util::UUID &id) {
+            if (s.getCharacters().findByUUID(id) == s.getCharacters().end()) {
+                return;
             }
+            auto c = s.getCharacters().getByUUID(id);
+            if (c->getFaction() != me && !c->hasGadget(gad->getType())) {
+                c->addGadget(gad);
+            }
+        };
+        for (const auto &it : characterGadgets) {
+            applyGadget(it.first, it.second);
         }
+
         for (const auto &it: poisonedCocktails) {
             if (std::holds_alternative<spy::util::UUID>(it)) {
                 // character has cocktail
@@ -81,19 +83,226 @@ namespace libclient::model {
         }
     }
 
+    void AIState::checkpoint() {
+        Checkpoint c{undoLog.size(), {}};
+        auto saveUsages = [&c](const std::shared_ptr<spy::gadget::Gadget> &gad) {
+            if (gad->getUsagesLeft().has_value()) {
+                c.usages.emplace_back(gad, gad->getUsagesLeft().value());
+            }
+        };
+        for (const auto &[gad, _]: unknownGadgets) {
+            saveUsages(gad);
+        }
+        for (const auto &[gad, _]: characterGadgets) {
+            saveUsages(gad);
+        }
+        for (const auto &gad: floorGadgets) {
+            saveUsages(gad);
+        }
+
+        checkpoints.push_back(std::move(c));
+    }
+
+    bool AIState::rollback() {
+        if (checkpoints.empty()) {
+            return false;
+        }
+        auto c = std::move(checkpoints.back());
+        checkpoints.pop_back();
+
+        // undo in reverse order, entries only touch the recorded members
+        while (undoLog.size() > c.undoLogSize) {
+            auto undo = std::move(undoLog.back());
+            undoLog.pop_back();
+            undo(*this);
+        }
+        for (const auto &[gad, usages]: c.usages) {
+            gad->setUsagesLeft(usages);
+        }
+        return true;
+    }
+
+    bool AIState::commit() {
+        if (checkpoints.empty()) {
+            return false;
+        }
+        checkpoints.pop_back();
+        if (checkpoints.empty()) {
+            // changes are kept for outer checkpoints only
+            undoLog.clear();
+        }
+        return true;
+    }
+
+    std::size_t AIState::getNumberOfCheckpoints() const {
+        return checkpoints.size();
+    }
+
+    bool AIState::changedSinceCheckpoint() const {
+        return !checkpoints.empty() && undoLog.size() > checkpoints.back().undoLogSize;
+    }
+
+    AIState AIState::fork() const {
+        AIState copy = *this;
+        copy.checkpoints.clear();
+        copy.undoLog.clear();
+
+        // replace shared gadgets by own objects (same object in different lists stays the same object)
+        std::map<std::shared_ptr<spy::gadget::Gadget>, std::shared_ptr<spy::gadget::Gadget>> clones;
+        auto clone = [&clones](const std::shared_ptr<spy::gadget::Gadget> &gad) {
+            auto &c = clones[gad];
+            if (!c) {
+                c = std::make_shared<spy::gadget::Gadget>(*gad);
+            }
+            return c;
+        };
+
+        decltype(unknownGadgets) forkedUnknownGadgets;
+        for (const auto &[gad, candidates]: copy.unknownGadgets) {
+            forkedUnknownGadgets.emplace(clone(gad), candidates);
+        }
+        decltype(characterGadgets) forkedCharacterGadgets;
+        for (const auto &[gad, owner]: copy.characterGadgets) {
+            forkedCharacterGadgets.emplace(clone(gad), owner);
+        }
+        decltype(floorGadgets) forkedFloorGadgets;
+        for (const auto &gad: copy.floorGadgets) {
+            forkedFloorGadgets.insert(clone(gad));
+        }
+        copy.unknownGadgets = std::move(forkedUnknownGadgets);
+        copy.characterGadgets = std::move(forkedCharacterGadgets);
+        copy.floorGadgets = std::move(forkedFloorGadgets);
+        return copy;
+    }
+
+    ProcessingStatistics
+    AIState::benchmark(const std::vector<std::shared_ptr<const spy::gameplay::BaseOperation>> &operations,
+                       const spy::gameplay::State &s, const spy::MatchConfig &config, spy::character::FactionEnum me,
+                       std::size_t repetitions) const {
+        std::chrono::duration<double> duration{0};
+        util::AllocationCount allocations;
+        for (std::size_t r = 0; r < repetitions; r++) {
+            auto copy = fork();
+            auto start = std::chrono::steady_clock::now();
+            util::AllocationScope scope;
+            copy.processOperations(operations, s, config, me);
+            allocations += scope.get();
+            duration += std::chrono::steady_clock::now() - start;
+        }
+
+        ProcessingStatistics statistics;
+        statistics.batches = repetitions;
+        if (repetitions > 0) {
+            auto n = static_cast<double>(repetitions);
+            statistics.secondsPerBatch = duration.count() / n;
+            statistics.allocationsPerBatch = static_cast<double>(allocations.allocations) / n;
+            statistics.bytesPerBatch = static_cast<double>(allocations.bytes) / n;
+        }
+        return statistics;
+    }
+
+    CheckpointStatistics
+    AIState::benchmarkCheckpoints(const std::vector<std::shared_ptr<const spy::gameplay::BaseOperation>> &operations,
+                                  const spy::gameplay::State &s, const spy::MatchConfig &config,
+                                  spy::character::FactionEnum me, std::size_t repetitions) const {
+        using Clock = std::chrono::steady_clock;
+        std::chrono::duration<double> checkpointDuration{0};
+        std::chrono::duration<double> rollbackDuration{0};
+        std::chrono::duration<double> copyDuration{0};
+        util::AllocationCount checkpointAllocations;
+        util::AllocationCount copyAllocations;
+        std::size_t undoEntries = 0;
+
+        auto copy = fork();
+        for (std::size_t r = 0; r < repetitions; r++) {
+            {
+                // former checkpoint: full copy of the beliefs
+                auto start = Clock::now();
+                util::AllocationScope scope;
+                AIState full = copy;
+                copyAllocations += scope.get();
+                copyDuration += Clock::now() - start;
+            }
+
+            auto start = Clock::now();
+            util::AllocationScope scope;
+            copy.checkpoint();
+            checkpointAllocations += scope.get();
+            checkpointDuration += Clock::now() - start;
+
+            copy.processOperations(operations, s, config, me);
+            undoEntries += copy.undoLog.size();
+
+            start = Clock::now();
+            copy.rollback();
+            rollbackDuration += Clock::now() - start;
+        }
+
+        CheckpointStatistics statistics;
+        statistics.checkpoints = repetitions;
+        if (repetitions > 0) {
+            auto n = static_cast<double>(repetitions);
+            statistics.secondsPerCheckpoint = checkpointDuration.count() / n;
+            statistics.secondsPerRollback = rollbackDuration.count() / n;
+            statistics.secondsPerCopy = copyDuration.count() / n;
+            statistics.undoEntriesPerBatch = static_cast<double>(undoEntries) / n;
+            statistics.allocationsPerCheckpoint = static_cast<double>(checkpointAllocations.allocations) / n;
+            statistics.allocationsPerCopy = static_cast<double>(copyAllocations.allocations) / n;
+        }
+        return statistics;
+    }
+
+    void AIState::takeGadgetsFromState(const spy::gameplay::State &s) {
+        // apply characterGadgets from state (only owners are collected, adding gadgets modifies characterGadgets)
+        std::set<spy::util::UUID> owners;
+        for (const auto &it : characterGadgets) {
+            owners.insert(it.second);
+        }
+        for (const auto &id: owners) {
+            auto c = s.getCharacters().findByUUID(id);
+            if (c == s.getCharacters().end()) {
+                continue;
+            }
+            for (const auto &gad: c->getGadgets()) {
+                addGadgetToCharacter(gad, id);
+            }
+        }
+    }
+
     bool AIState::addFaction(const spy::util::UUID &id, std::set<spy::util::UUID> &factionList) {
         auto charId = unknownFaction.find(id);
         if (charId == unknownFaction.end()) {
             return false;
         }
+        for (auto list: {&AIState::myFaction, &AIState::enemyFaction, &AIState::npcFaction}) {
+            if (&(this->*list) == &factionList) {
+                saveEntry(list, charId->first);
+            }
+        }
+        saveEntry(&AIState::excludedFactions, charId->first);
+        saveEntry(&AIState::unknownFaction, charId->first);
         factionList.insert(charId->first);
+        excludedFactions.erase(charId->first);
         unknownFaction.erase(charId);
         return true;
     }
 
+    bool AIState::excludeFaction(const spy::util::UUID &id, spy::character::FactionEnum faction) {
+        if (unknownFaction.find(id) == unknownFaction.end()) {
+            return false;
+        }
+        auto excluded = excludedFactions.find(id);
+        if (excluded != excludedFactions.end() && excluded->second.find(faction) != excluded->second.end()) {
+            return true;
+        }
+        saveEntry(&AIState::excludedFactions, id);
+        excludedFactions[id].insert(faction);
+        return true;
+    }
+
     bool
     AIState::addGadget(spy::gadget::GadgetEnum gadgetType, const std::optional<spy::util::UUID> &id) {
-        auto gadget = std::make_shared<spy::gadget::Gadget>(gadgetType);
+        const auto &gadget = util::GadgetKeys::get(gadgetType);
 
         if (id.has_value()) {
             // add Gadget to characterGadgets list
@@ -104,8 +313,26 @@ namespace libclient::model {
         return addGadgetToFloor(gadget);
     }
 
-    bool
-    AIState::addGadgetToCharacter(const std::shared_ptr<spy::gadget::Gadget> &gadgetType, const spy::util::UUID &id) {
+    void AIState::addUnknownGadgets() {
+        for (auto type: util::GadgetKeys::getTypes()) {
+            if (unknownGadgets.find(util::GadgetKeys::get(type)) == unknownGadgets.end()) {
+                saveEntry(&AIState::unknownGadgets, util::GadgetKeys::get(type));
+                unknownGadgets.emplace(std::make_shared<spy::gadget::Gadget>(type),
+                                       std::vector<std::pair<spy::util::UUID, std::vector<double>>>{});
+            }
+        }
+    }
+
+    bool AIState::isGadgetOnFloor(spy::gadget::GadgetEnum type) const {
+        // linear search over at most one entry per gadget type, avoids creating a key gadget
+        return std::any_of(floorGadgets.begin(), floorGadgets.end(),
+                           [type](const std::shared_ptr<spy::gadget::Gadget> &gad) {
+                               return gad->getType() == type;
+                           });
+    }
+
+    bool AIState::addGadgetToCharacter(const std::shared_ptr<const spy::gadget::Gadget> &gadgetType,
+                                       const spy::util::UUID &id) {
         auto unknown = unknownGadgets.find(gadgetType);
 
         if (unknown == unknownGadgets.end()) {
@@ -116,21 +343,26 @@ namespace libclient::model {
                     return false;
                 }
                 // from characterGadgets list to characterGadgets list
+                saveEntry(&AIState::characterGadgets, gadgetType);
                 character->second = id;
                 return true;
             }
             // from floorGadgets list to characterGadgets list
+            saveEntry(&AIState::characterGadgets, gadgetType);
+            saveEntry(&AIState::floorGadgets, gadgetType);
             characterGadgets[*floor] = id;
             floorGadgets.erase(floor);
             return true;
         }
         // from unknownGadgets list to characterGadgets list
+        saveEntry(&AIState::characterGadgets, gadgetType);
+        saveEntry(&AIState::unknownGadgets, gadgetType);
         characterGadgets[unknown->first] = id;
         unknownGadgets.erase(unknown);
         return true;
     }
 
-    bool AIState::addGadgetToFloor(const std::shared_ptr<spy::gadget::Gadget> &gadgetType) {
+    bool AIState::addGadgetToFloor(const std::shared_ptr<const spy::gadget::Gadget> &gadgetType) {
         auto unknown = unknownGadgets.find(gadgetType);
 
         if (unknown == unknownGadgets.end()) {
@@ -140,64 +372,80 @@ namespace libclient::model {
                 return floor != floorGadgets.end(); // from floorGadgets list to floorGadgets list
             }
             // from characterGadgets list to floorGadgets list
+            saveEntry(&AIState::floorGadgets, gadgetType);
+            saveEntry(&AIState::characterGadgets, gadgetType);
             floorGadgets.insert(character->first);
             characterGadgets.erase(character);
             return true;
         }
         // from unknownGadgets list to floorGadgets list
+        saveEntry(&AIState::floorGadgets, gadgetType);
+        saveEntry(&AIState::unknownGadgets, gadgetType);
         floorGadgets.insert(unknown->first);
         unknownGadgets.erase(unknown);
         return true;
     }
 
-    void AIState::processOperation(std::shared_ptr<const spy::gameplay::BaseOperation> operation,
+    void AIState::eraseCharacterGadget(const std::shared_ptr<const spy::gadget::Gadget> &gadgetType) {
+        auto character = characterGadgets.find(gadgetType);
+        if (character != characterGadgets.end()) {
+            saveEntry(&AIState::characterGadgets, gadgetType);
+            characterGadgets.erase(character);
+        }
+    }
+
+    void AIState::processOperation(const spy::gameplay::BaseOperation &operation,
                                    const spy::gameplay::State &s, const spy::MatchConfig &config,
                                    spy::character::FactionEnum me) {
         // check for getting rid of MOLEDIE
         processGettingRidOfMoledie(operation);
 
-        switch (operation->getType()) {
-            case spy::gameplay::OperationEnum::GADGET_ACTION: {
-                auto op = std::dynamic_pointer_cast<const spy::gameplay::GadgetAction>(operation);
-                processGadgetAction(op, s, config, me);
-                break;
-            }
-            case spy::gameplay::OperationEnum::SPY_ACTION: {
-                auto op = std::dynamic_pointer_cast<const spy::gameplay::SpyAction>(operation);
-                processSpyAction(op, s, config, me);
-                break;
-            }
-            case spy::gameplay::OperationEnum::PROPERTY_ACTION: {
-                auto op = std::dynamic_pointer_cast<const spy::gameplay::PropertyAction>(operation);
-                processPropertyAction(op, s);
-                break;
-            }
-            case spy::gameplay::OperationEnum::MOVEMENT: {
-                auto op = std::dynamic_pointer_cast<const spy::gameplay::Movement>(operation);
-
-                // collect gadget if gadget is on target field
-                auto gadget = s.getMap().getField(op->getTarget()).getGadget();
-                if (gadget.has_value()) {
-                    addGadgetToCharacter(gadget.value(), op->getCharacterId());
+        // concrete type is resolved once, handlers borrow the operation
+        util::visitOperation(operation, util::Overloaded{
+                [&](const spy::gameplay::GadgetAction &op) {
+                    processGadgetAction(op, s, config, me);
+                },
+                [&](const spy::gameplay::SpyAction &op) {
+                    processSpyAction(op, s, config, me);
+                },
+                [&](const spy::gameplay::PropertyAction &op) {
+                    processPropertyAction(op, s);
+                },
+                [&](const spy::gameplay::Movement &op) {
+                    // collect gadget if gadget is on target field
+                    const auto &gadget = s.getMap().getField(op.getTarget()).getGadget();
+                    if (gadget.has_value()) {
+                        addGadgetToCharacter(gadget.value(), op.getCharacterId());
+                    }
+                },
+                [](const spy::gameplay::BaseOperation &) {
+                    // no additional info can be gained
                 }
+        });
+    }
 
-                break;
-            }
-            default:
-                // no additional info can be gained
-                break;
+    void AIState::processOperations(const std::vector<std::shared_ptr<const spy::gameplay::BaseOperation>> &operations,
+                                    const spy::gameplay::State &s, const spy::MatchConfig &config,
+                                    spy::character::FactionEnum me) {
+        // s is the state before all operations -> its gadgets are older than every operation of the batch
+        takeGadgetsFromState(s);
+
+        // s does not change during the batch -> resolve targets by coordinates in O(1)
+        characterGrid.build(s);
+        characterGridValid = true;
+        for (const auto &op: operations) {
+            processOperation(*op, s, config, me);
         }
+        characterGridValid = false;
     }
 
-    void AIState::processGettingRidOfMoledie(std::shared_ptr<const spy::gameplay::BaseOperation> operation) {
-        auto opType = operation->getType();
-        if (opType == spy::gameplay::OperationEnum::CAT_ACTION ||
-            opType == spy::gameplay::OperationEnum::JANITOR_ACTION ||
-            opType == spy::gameplay::OperationEnum::EXFILTRATION) {
+    void AIState::processGettingRidOfMoledie(const spy::gameplay::BaseOperation &operation) {
+        auto opType = operation.getType();
+        auto op = util::asCharacterOperation(operation);
+        if (op == nullptr || opType == spy::gameplay::OperationEnum::EXFILTRATION) {
             return;
         }
 
-        auto op = std::dynamic_pointer_cast<const spy::gameplay::CharacterOperation>(operation);
         if (op->getCharacterId() != lastCharTurn) {
             // next characters turn
 
@@ -218,29 +466,33 @@ namespace libclient::model {
                 }
             }
 
+            saveMember(&AIState::lastCharTurn);
+            saveMember(&AIState::gotRidOfMoleDie);
+            saveMember(&AIState::madeAction);
             lastCharTurn = op->getCharacterId();
             gotRidOfMoleDie = false;
             madeAction = false;
         }
 
-        if (opType != spy::gameplay::OperationEnum::MOVEMENT && opType != spy::gameplay::OperationEnum::RETIRE) {
+        if (opType != spy::gameplay::OperationEnum::MOVEMENT && opType != spy::gameplay::OperationEnum::RETIRE &&
+            !madeAction) {
+            saveMember(&AIState::madeAction);
             madeAction = true;
         }
     }
 
-    void AIState::processPropertyAction(std::shared_ptr<const spy::gameplay::PropertyAction> op,
+    void AIState::processPropertyAction(const spy::gameplay::PropertyAction &op,
                                         const spy::gameplay::State &s) {
-        if (op->getUsedProperty() == spy::character::PropertyEnum::OBSERVATION) {
+        if (op.getUsedProperty() == spy::character::PropertyEnum::OBSERVATION) {
 
             // isEnemy -> target character faction is enemy, not isEnemy -> target char is npc (take pocketlitter into account)
-            if (op->isSuccessful()) {
-                auto targetChar = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(
-                        s.getCharacters(),
-                        op->getTarget());
-                if (op->getIsEnemy()) {
+            if (op.isSuccessful()) {
+                auto targetChar = findCharacterAt(s, op.getTarget());
+                if (op.getIsEnemy()) {
                     addFaction(targetChar->getCharacterId(), enemyFaction);
                 } else {
-                    auto probHasCharacterPocketLitter = hasCharacterGadget(op->getCharacterId(),
+                    // pocket litter hides the faction of the observed character
+                    auto probHasCharacterPocketLitter = hasCharacterGadget(targetChar->getCharacterId(),
                                                                            spy::gadget::GadgetEnum::POCKET_LITTER);
                     if (probHasCharacterPocketLitter.has_value()) {
                         if (probHasCharacterPocketLitter == 0) {
@@ -251,33 +503,38 @@ namespace libclient::model {
                                                        1 - probHasCharacterPocketLitter.value());
                         }
                     }
+                    // not enemy for my observer -> npc or enemy with pocket litter, never my character
+                    if (myFaction.find(op.getCharacterId()) != myFaction.end()) {
+                        excludeFaction(targetChar->getCharacterId(), spy::character::FactionEnum::PLAYER1);
+                    }
                 }
             }
         }
     }
 
-    void AIState::processSpyAction(std::shared_ptr<const spy::gameplay::SpyAction> op,
+    void AIState::processSpyAction(const spy::gameplay::SpyAction &op,
                                    const spy::gameplay::State &s, const spy::MatchConfig &config,
                                    spy::character::FactionEnum me) {
-        auto targetChar = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(s.getCharacters(),
-                                                                                     op->getTarget());
-        auto sourceChar = s.getCharacters().findByUUID(op->getCharacterId());
+        auto targetChar = findCharacterAt(s, op.getTarget());
+        auto sourceChar = s.getCharacters().findByUUID(op.getCharacterId());
         bool isSourceCharMyFaction = myFaction.find(sourceChar->getCharacterId()) != myFaction.end();
 
         if (targetChar != s.getCharacters().end()) { // spy on person
             // spy on me -> executor is enemy
             bool isTargetCharMyFaction = myFaction.find(targetChar->getCharacterId()) != myFaction.end();
             if (isTargetCharMyFaction && !isSourceCharMyFaction) {
-                addFaction(targetChar->getCharacterId(), enemyFaction);
+                addFaction(sourceChar->getCharacterId(), enemyFaction);
             }
 
             // spy successful -> target is npc, track safe combinations Client has
-            if (op->isSuccessful() && isSourceCharMyFaction) {
+            if (op.isSuccessful() && isSourceCharMyFaction) {
                 addFaction(targetChar->getCharacterId(), npcFaction);
 
                 for (int comb: s.getMySafeCombinations()) {
                     auto known = safeCombinations.find(comb) != safeCombinations.end();
                     if (!known) {
+                        saveEntry(&AIState::safeCombinations, comb);
+                        saveEntry(&AIState::combinationsFromNpcs, targetChar->getCharacterId());
                         safeCombinations.insert(comb);
                         combinationsFromNpcs.insert(targetChar->getCharacterId());
                     }
@@ -285,7 +542,7 @@ namespace libclient::model {
             }
 
             // spy not successful -> target is enemy with prob
-            if (!op->isSuccessful() && isSourceCharMyFaction && config.getSpySuccessChance() != 0) {
+            if (!op.isSuccessful() && isSourceCharMyFaction && config.getSpySuccessChance() != 0) {
                 push_back_toUnknownFaction(targetChar->getCharacterId(),
                                            me == spy::character::FactionEnum::PLAYER1
                                            ? spy::character::FactionEnum::PLAYER2
@@ -294,88 +551,99 @@ namespace libclient::model {
             }
 
         } else { // spy on safe
-            unsigned int safeIndex = safePosToIndex(s, op->getTarget());
+            if (!safes.isBuilt()) {
+                // level unknown (e.g. configs set by client) -> take safes of state
+                saveMember(&AIState::safes);
+                safes.build(s.getMap());
+            }
+            auto safe = safePosToIndex(op.getTarget());
+            if (!safe.has_value()) {
+                return;
+            }
+            auto safeIndex = safe.value();
 
             // track which safes are opened by Client
             if (isSourceCharMyFaction) {
-                if (op->isSuccessful()) {
+                if (op.isSuccessful()) {
+                    saveEntry(&AIState::openedSafes, safeIndex);
+                    saveEntry(&AIState::openedSafesTotal, safeIndex);
+                    saveEntry(&AIState::triedSafes, safeIndex);
+                    saveMember(&AIState::safes);
                     openedSafes.insert(safeIndex);
                     openedSafesTotal.insert(safeIndex);
+                    safes.markOpened(safeIndex, true);
                     triedSafes.erase(safeIndex);
                 } else {
+                    saveEntry(&AIState::triedSafes, safeIndex);
                     triedSafes.insert(std::pair<int, int>(safeIndex, safeCombinations.size()));
                 }
             }
 
             // executor has diamond collar with prob
-            if (!isSourceCharMyFaction && op->isSuccessful() &&
-                std::find(openedSafesTotal.begin(), openedSafesTotal.end(), safeIndex) !=
-                openedSafesTotal.end()) { // safe was not opened before
+            if (!isSourceCharMyFaction && op.isSuccessful() &&
+                openedSafesTotal.find(safeIndex) == openedSafesTotal.end()) { // safe was not opened before
+                saveEntry(&AIState::openedSafesTotal, safeIndex);
+                saveMember(&AIState::safes);
                 openedSafesTotal.insert(safeIndex);
+                safes.markOpened(safeIndex, false);
 
-                unsigned int numOfSafes = 1;
-                auto m = s.getMap();
-                for (auto y = 0U; y < m.getMap().size(); y++) {
-                    for (auto x = 0U; x < m.getMap().at(y).size(); x++) {
-                        const spy::scenario::Field f = m.getField(x, y);
-                        if (f.getFieldState() == spy::scenario::FieldStateEnum::SAFE) {
-                            numOfSafes += 1;
-                        }
-                    }
-                }
-
-                auto gad = std::make_shared<spy::gadget::Gadget>(spy::gadget::GadgetEnum::DIAMOND_COLLAR);
+                // diamond collar is in one of the safes
+                auto numOfSafes = safes.getNumberOfSafes();
+                const auto &gad = util::GadgetKeys::get(spy::gadget::GadgetEnum::DIAMOND_COLLAR);
                 if (numOfSafes == 1) {
-                    addGadgetToCharacter(gad, op->getCharacterId());
-                } else { // maxSafeIndex is always >= 1
-                    double prob = 1 / numOfSafes;
-                    push_back_toUnknownGadgets(gad, op->getCharacterId(), prob);
+                    addGadgetToCharacter(gad, op.getCharacterId());
+                } else if (numOfSafes > 1) {
+                    double prob = 1 / static_cast<double>(numOfSafes);
+                    push_back_toUnknownGadgets(gad, op.getCharacterId(), prob);
                 }
             }
         }
     }
 
-    void AIState::processGadgetAction(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+    void AIState::processGadgetAction(const spy::gameplay::GadgetAction &action,
                                       const spy::gameplay::State &s, const spy::MatchConfig &config,
                                       spy::character::FactionEnum me) {
-        auto gadgetType = std::make_shared<spy::gadget::Gadget>(action->getGadget());
+        // lookup key of the used gadget, shared by all helpers below
+        const auto &gadgetType = util::GadgetKeys::get(action.getGadget());
 
         // executing character has gadget
-        addGadgetToCharacter(gadgetType, action->getCharacterId());
+        addGadgetToCharacter(gadgetType, action.getCharacterId());
 
-        switch (action->getGadget()) {
+        switch (action.getGadget()) {
             case spy::gadget::GadgetEnum::HAIRDRYER:
                 processGadgetHairdryer(action, s);
                 break;
             case spy::gadget::GadgetEnum::MOLEDIE:
                 // track getting rid of MOLEDIE
+                saveMember(&AIState::gotRidOfMoleDie);
                 gotRidOfMoleDie = true;
 
-                processGadgetMoledie(action, s, config);
+                processGadgetMoledie(action, gadgetType, s, config);
                 break;
             case spy::gadget::GadgetEnum::TECHNICOLOUR_PRISM:
                 // invert roulette table
-                posOfInvertedRoulette = action->getTarget();
+                saveMember(&AIState::posOfInvertedRoulette);
+                posOfInvertedRoulette = action.getTarget();
 
                 // after usage: disappear
-                characterGadgets.erase(gadgetType);
+                eraseCharacterGadget(gadgetType);
                 break;
             case spy::gadget::GadgetEnum::BOWLER_BLADE:
-                processGadgetBowlerBlade(action, s, config);
+                processGadgetBowlerBlade(action, gadgetType, s, config);
                 break;
             case spy::gadget::GadgetEnum::POISON_PILLS:
-                processGadgetPoisonPills(action, s);
+                processGadgetPoisonPills(action, gadgetType, s);
                 break;
             case spy::gadget::GadgetEnum::LASER_COMPACT:
                 processGadgetLaserCompact(action, s);
                 break;
             case spy::gadget::GadgetEnum::ROCKET_PEN:
                 // after usage: disappear
-                characterGadgets.erase(gadgetType);
+                eraseCharacterGadget(gadgetType);
                 break;
             case spy::gadget::GadgetEnum::GAS_GLOSS:
                 // after usage: disappear
-                characterGadgets.erase(gadgetType);
+                eraseCharacterGadget(gadgetType);
                 break;
             case spy::gadget::GadgetEnum::MOTHBALL_POUCH:
                 // after usage: modify usagesLeft
@@ -383,27 +651,27 @@ namespace libclient::model {
                 break;
             case spy::gadget::GadgetEnum::FOG_TIN:
                 // after usage: disappear
-                characterGadgets.erase(gadgetType);
+                eraseCharacterGadget(gadgetType);
                 break;
             case spy::gadget::GadgetEnum::GRAPPLE:
                 processGadgetGrapple(action, s);
                 break;
             case spy::gadget::GadgetEnum::WIRETAP_WITH_EARPLUGS:
                 // after usage: disappear
-                characterGadgets.erase(gadgetType);
+                eraseCharacterGadget(gadgetType);
                 break;
             case spy::gadget::GadgetEnum::JETPACK:
                 // after usage: disappear
-                characterGadgets.erase(gadgetType);
+                eraseCharacterGadget(gadgetType);
                 break;
             case spy::gadget::GadgetEnum::CHICKEN_FEED:
-                processGadgetChickenFeed(action, s);
+                processGadgetChickenFeed(action, gadgetType, s);
                 break;
             case spy::gadget::GadgetEnum::NUGGET:
-                processGadgetNugget(action, s, me);
+                processGadgetNugget(action, gadgetType, s, me);
                 break;
             case spy::gadget::GadgetEnum::MIRROR_OF_WILDERNESS:
-                processGadgetMirrorOfWilderness(action, s);
+                processGadgetMirrorOfWilderness(action, gadgetType, s);
                 break;
             case spy::gadget::GadgetEnum::COCKTAIL:
                 processGadgetCocktail(action, s);
@@ -414,80 +682,83 @@ namespace libclient::model {
         }
     }
 
-    void AIState::processGadgetHairdryer(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+    void AIState::processGadgetHairdryer(const spy::gameplay::GadgetAction &action,
                                          const spy::gameplay::State &s) {
-        auto targetChar = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(s.getCharacters(),
-                                                                                     action->getTarget());
+        auto targetChar = findCharacterAt(s, action.getTarget());
         // remove property clammy clothes from target character
+        saveEntry(&AIState::properties, targetChar->getCharacterId());
         properties.at(targetChar->getCharacterId()).erase(spy::character::PropertyEnum::CLAMMY_CLOTHES);
     }
 
-    void AIState::processGadgetMirrorOfWilderness(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+    void AIState::processGadgetMirrorOfWilderness(const spy::gameplay::GadgetAction &action,
+                                                  const std::shared_ptr<const spy::gadget::Gadget> &gadgetType,
                                                   const spy::gameplay::State &s) {
-        auto targetChar = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(s.getCharacters(),
-                                                                                     action->getTarget());
-        auto gadgetType = std::make_shared<spy::gadget::Gadget>(action->getGadget());
+        auto targetChar = findCharacterAt(s, action.getTarget());
 
         // after usage: not same faction and working -> disappear
-        if (getFaction(action->getCharacterId()) != getFaction(targetChar->getCharacterId()) &&
-            action->isSuccessful()) {
-            characterGadgets.erase(gadgetType);
+        if (getFaction(action.getCharacterId()) != getFaction(targetChar->getCharacterId()) &&
+            action.isSuccessful()) {
+            eraseCharacterGadget(gadgetType);
         }
     }
 
-    void AIState::processGadgetGrapple(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+    void AIState::processGadgetGrapple(const spy::gameplay::GadgetAction &action,
                                        const spy::gameplay::State &s) {
-        auto targetField = s.getMap().getField(action->getTarget());
+        const auto &targetField = s.getMap().getField(action.getTarget());
 
         // add gadget hit by grapple to executing character
-        if (action->isSuccessful()) {
-            addGadgetToCharacter(
-                    std::make_shared<spy::gadget::Gadget>(targetField.getGadget().value()->getType()),
-                    action->getCharacterId());
+        if (action.isSuccessful()) {
+            addGadgetToCharacter(util::GadgetKeys::get(targetField.getGadget().value()->getType()),
+                                 action.getCharacterId());
         }
     }
 
-    void AIState::processGadgetChickenFeed(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+    void AIState::processGadgetChickenFeed(const spy::gameplay::GadgetAction &action,
+                                           const std::shared_ptr<const spy::gadget::Gadget> &gadgetType,
                                            const spy::gameplay::State &s) {
-        auto targetChar = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(s.getCharacters(),
-                                                                                     action->getTarget());
-        auto gadgetType = std::make_shared<spy::gadget::Gadget>(action->getGadget());
+        auto targetChar = findCharacterAt(s, action.getTarget());
 
-        // not working -> target is np, working -> target is enemy
-        if (action->isSuccessful()) {
+        // working -> target is enemy, not working -> target is no opponent of the executor
+        auto executor = getFaction(action.getCharacterId());
+        if (action.isSuccessful()) {
             addFaction(targetChar->getCharacterId(), enemyFaction);
-        } else if (getFaction(action->getCharacterId()) != getFaction(targetChar->getCharacterId())) {
+        } else if (executor == spy::character::FactionEnum::PLAYER2) {
+            // failed feed of the enemy -> target is npc or the enemy's own character, never mine
+            excludeFaction(targetChar->getCharacterId(), spy::character::FactionEnum::PLAYER1);
+        } else if (executor == spy::character::FactionEnum::PLAYER1 &&
+                   myFaction.find(targetChar->getCharacterId()) == myFaction.end()) {
+            // failed feed of mine -> target is no enemy and (all my characters are known) not mine
             addFaction(targetChar->getCharacterId(), npcFaction);
         }
 
         // after usage: disappear
-        characterGadgets.erase(gadgetType);
+        eraseCharacterGadget(gadgetType);
     }
 
-    void AIState::processGadgetPoisonPills(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+    void AIState::processGadgetPoisonPills(const spy::gameplay::GadgetAction &action,
+                                           const std::shared_ptr<const spy::gadget::Gadget> &gadgetType,
                                            const spy::gameplay::State &s) {
-        auto targetChar = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(s.getCharacters(),
-                                                                                     action->getTarget());
-        auto gadgetType = std::make_shared<spy::gadget::Gadget>(action->getGadget());
+        auto targetChar = findCharacterAt(s, action.getTarget());
 
         // cocktail at target is poisoned
+        saveMember(&AIState::poisonedCocktails);
         if (targetChar != s.getCharacters().end()) { // character holds cocktail
             poisonedCocktails.emplace_back(targetChar->getCharacterId());
         } else { // cocktail is on bar table
-            poisonedCocktails.emplace_back(action->getTarget());
+            poisonedCocktails.emplace_back(action.getTarget());
         }
 
         // after usage: modify usagesLeft
         modifyUsagesLeft(characterGadgets.find(gadgetType)->first);
     }
 
-    void AIState::processGadgetLaserCompact(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+    void AIState::processGadgetLaserCompact(const spy::gameplay::GadgetAction &action,
                                             const spy::gameplay::State &s) {
-        auto targetChar = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(s.getCharacters(),
-                                                                                     action->getTarget());
+        auto targetChar = findCharacterAt(s, action.getTarget());
 
         // if done on poisoned cocktail -> remove from poisonedCocktails list
-        if (action->isSuccessful()) {
+        if (action.isSuccessful()) {
+            saveMember(&AIState::poisonedCocktails);
             if (targetChar != s.getCharacters().end()) { // character holds cocktail
                 poisonedCocktails.erase(std::remove(poisonedCocktails.begin(), poisonedCocktails.end(),
                                                     std::variant<spy::util::UUID, spy::util::Point>(
@@ -495,17 +766,16 @@ namespace libclient::model {
             } else { // cocktail is on bar table
                 poisonedCocktails.erase(
                         std::remove(poisonedCocktails.begin(), poisonedCocktails.end(),
-                                    std::variant<spy::util::UUID, spy::util::Point>(action->getTarget())),
+                                    std::variant<spy::util::UUID, spy::util::Point>(action.getTarget())),
                         poisonedCocktails.end());
             }
         }
     }
 
-    void AIState::processGadgetMoledie(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+    void AIState::processGadgetMoledie(const spy::gameplay::GadgetAction &action,
+                                       const std::shared_ptr<const spy::gadget::Gadget> &gadgetType,
                                        const spy::gameplay::State &s, const spy::MatchConfig &config) {
-        auto gadgetType = std::make_shared<spy::gadget::Gadget>(action->getGadget());
-        auto targetChar = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(s.getCharacters(),
-                                                                                     action->getTarget());
+        auto targetChar = findCharacterAt(s, action.getTarget());
 
         // after usage: target is character -> target owns moledie (take honey trap into account)
         //              target is floor -> bowler blade is owned by closest character to target point
@@ -513,32 +783,34 @@ namespace libclient::model {
             if (!hasCharacterProperty(targetChar->getCharacterId(), spy::character::PropertyEnum::HONEY_TRAP)) {
                 addGadgetToCharacter(gadgetType, targetChar->getCharacterId());
             } else {
-                characterGadgets.erase(gadgetType);
+                eraseCharacterGadget(gadgetType);
                 double prob = 1 - config.getHoneyTrapSuccessChance();
                 if (prob == 1) { // honeyTrapSuccessChange is 0
                     addGadgetToCharacter(gadgetType, targetChar->getCharacterId());
                 } else if (prob != 0) {
                     auto gadget = characterGadgets.find(gadgetType)->first;
+                    saveEntry(&AIState::unknownGadgets, gadget);
+                    saveEntry(&AIState::characterGadgets, gadget);
                     unknownGadgets[gadget];
                     push_back_toUnknownGadgets(gadget, targetChar->getCharacterId(), prob);
                     characterGadgets.erase(gadget);
                 }
             }
         } else { // target is floor
-            auto closestPoints = spy::util::GameLogicUtils::getCharacterNearFields(s, action->getTarget());
+            auto closestPoints = spy::util::GameLogicUtils::getCharacterNearFields(s, action.getTarget());
             if (closestPoints.size() == 1) {
                 // clear where moledie goes
-                auto closestPerson = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(
-                        s.getCharacters(), closestPoints[0]);
+                auto closestPerson = findCharacterAt(s, closestPoints[0]);
                 addGadgetToCharacter(gadgetType, closestPerson->getCharacterId());
             } else {
                 // unclear where moledie goes
                 double prob = 1 / closestPoints.size();
                 auto gadget = characterGadgets.find(gadgetType)->first;
+                saveEntry(&AIState::unknownGadgets, gadget);
+                saveEntry(&AIState::characterGadgets, gadget);
                 unknownGadgets[gadget];
                 for (auto p: closestPoints) {
-                    auto person = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(s.getCharacters(),
-                                                                                             p);
+                    auto person = findCharacterAt(s, p);
                     push_back_toUnknownGadgets(gadget, person->getCharacterId(), prob);
                 }
                 characterGadgets.erase(gadget);
@@ -546,53 +818,55 @@ namespace libclient::model {
         }
     }
 
-    void AIState::processGadgetCocktail(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+    void AIState::processGadgetCocktail(const spy::gameplay::GadgetAction &action,
                                         const spy::gameplay::State &s) {
-        auto targetChar = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(s.getCharacters(),
-                                                                                     action->getTarget());
-        auto sourceChar = s.getCharacters().findByUUID(action->getCharacterId());
+        auto targetChar = findCharacterAt(s, action.getTarget());
+        auto sourceChar = s.getCharacters().findByUUID(action.getCharacterId());
 
         bool pour = targetChar != s.getCharacters().end();
-        bool drink = sourceChar->getCoordinates().value() == action->getTarget();
+        bool drink = sourceChar->getCoordinates().value() == action.getTarget();
 
         // poured or drunk -> remove from poisonedCocktails list
+        saveMember(&AIState::poisonedCocktails);
         if (pour || drink) {
             poisonedCocktails.erase(
                     std::remove(poisonedCocktails.begin(), poisonedCocktails.end(),
-                                std::variant<spy::util::UUID, spy::util::Point>(action->getCharacterId())),
+                                std::variant<spy::util::UUID, spy::util::Point>(action.getCharacterId())),
                     poisonedCocktails.end());
         }
 
         // successfully poured -> add property clammy clothes to target
-        if (pour && action->isSuccessful()) {
+        if (pour && action.isSuccessful()) {
+            saveEntry(&AIState::properties, targetChar->getCharacterId());
             properties.at(targetChar->getCharacterId()).insert(spy::character::PropertyEnum::CLAMMY_CLOTHES);
         }
 
         // taken from bar table and poisoned -> update poisonedCocktails
         if (!pour && !drink) {
             auto cocktail = std::remove(poisonedCocktails.begin(), poisonedCocktails.end(),
-                                        std::variant<spy::util::UUID, spy::util::Point>(action->getTarget()));
+                                        std::variant<spy::util::UUID, spy::util::Point>(action.getTarget()));
             if (cocktail != poisonedCocktails.end()) {
                 // cocktail from bar table is poisoned
                 poisonedCocktails.erase(cocktail, poisonedCocktails.end());
-                poisonedCocktails.emplace_back(action->getCharacterId());
+                poisonedCocktails.emplace_back(action.getCharacterId());
             }
         }
     }
 
-    void AIState::processGadgetBowlerBlade(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+    void AIState::processGadgetBowlerBlade(const spy::gameplay::GadgetAction &action,
+                                           const std::shared_ptr<const spy::gadget::Gadget> &gadgetType,
                                            const spy::gameplay::State &s, const spy::MatchConfig &config) {
-        auto gadgetType = std::make_shared<spy::gadget::Gadget>(action->getGadget());
-        auto targetChar = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(s.getCharacters(),
-                                                                                     action->getTarget());
+        auto targetChar = findCharacterAt(s, action.getTarget());
 
         // not working -> target has MAGENTIC_WATCH (take into account: prob of success) with prob
-        if (!action->isSuccessful()) {
+        if (!action.isSuccessful()) {
             auto probHasMagenticWatch = hasCharacterGadget(targetChar->getCharacterId(),
                                                            spy::gadget::GadgetEnum::MAGNETIC_WATCH);
             if (probHasMagenticWatch.has_value()) {
                 if (probHasMagenticWatch.value() != 0 && probHasMagenticWatch.value() != 1) {
-                    int numBabysitter = spy::util::GameLogicUtils::babysitterNumber(s, action);
+                    // non owning pointer, GameLogicUtils only reads the action
+                    int numBabysitter = spy::util::GameLogicUtils::babysitterNumber(
+                            s, std::shared_ptr<const spy::gameplay::GadgetAction>(std::shared_ptr<void>(), &action));
                     double prob = 1 - (config.getBowlerBladeHitChance() *
                                        (std::pow(1 - config.getBabysitterSuccessChance(), numBabysitter)));
                     if (prob != 0 && prob != 1) {
@@ -606,40 +880,68 @@ namespace libclient::model {
         addGadgetToFloor(gadgetType);
     }
 
-    void AIState::processGadgetNugget(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+    void AIState::processGadgetNugget(const spy::gameplay::GadgetAction &action,
+                                      const std::shared_ptr<const spy::gadget::Gadget> &gadgetType,
                                       const spy::gameplay::State &s,
                                       spy::character::FactionEnum me) {
-        auto gadgetType = std::make_shared<spy::gadget::Gadget>(action->getGadget());
-        auto targetChar = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(s.getCharacters(),
-                                                                                     action->getTarget());
+        auto targetChar = findCharacterAt(s, action.getTarget());
 
         // not working -> target is enemy, working -> target was npc and now joins my faction
         // after usage: not working -> move to target character, working -> disappear
-        if (!action->isSuccessful()) {
-            if (getFaction(action->getCharacterId()) != getFaction(targetChar->getCharacterId())) {
+        if (!action.isSuccessful()) {
+            // a nugget is always accepted by npcs, independent of the faction of the user
+            excludeFaction(targetChar->getCharacterId(), spy::character::FactionEnum::NEUTRAL);
+            if (getFaction(action.getCharacterId()) != getFaction(targetChar->getCharacterId())) {
                 addFaction(targetChar->getCharacterId(), enemyFaction);
             }
-            characterGadgets[gadgetType] = targetChar->getCharacterId();
+            saveEntry(&AIState::characterGadgets, gadgetType);
+            auto gadget = characterGadgets.find(gadgetType);
+            if (gadget != characterGadgets.end()) {
+                gadget->second = targetChar->getCharacterId();
+            } else {
+                // own gadget object, the key is shared
+                characterGadgets.emplace(std::make_shared<spy::gadget::Gadget>(gadgetType->getType()),
+                                         targetChar->getCharacterId());
+            }
         } else {
             addFaction(targetChar->getCharacterId(), npcFaction);
+            saveEntry(&AIState::npcFaction, targetChar->getCharacterId());
             npcFaction.erase(targetChar->getCharacterId());
 
             auto enem = me == spy::character::FactionEnum::PLAYER1
                         ? spy::character::FactionEnum::PLAYER2
                         : spy::character::FactionEnum::PLAYER1;
-            auto isSourceMyFaction = hasCharacterFaction(action->getCharacterId(), me, me);
-            auto isSourceEnemyFaction = hasCharacterFaction(action->getCharacterId(),
+            auto isSourceMyFaction = hasCharacterFaction(action.getCharacterId(), me, me);
+            auto isSourceEnemyFaction = hasCharacterFaction(action.getCharacterId(),
                                                             enem, me);
-            auto isSourceNpcFaction = hasCharacterFaction(action->getCharacterId(),
+            auto isSourceNpcFaction = hasCharacterFaction(action.getCharacterId(),
                                                           spy::character::FactionEnum::NEUTRAL, me);
 
+            // npc joins faction of source -> faction sizes change
+            saveMember(&AIState::factionCounts);
+            auto joinFaction = [this](FactionCount &count) {
+                count.min += count.min != 0;
+                count.max += count.max != std::numeric_limits<unsigned int>::max();
+                factionCounts.npc.min -= factionCounts.npc.min != 0;
+                factionCounts.npc.max -= factionCounts.npc.max != 0 &&
+                                         factionCounts.npc.max != std::numeric_limits<unsigned int>::max();
+            };
+
             if (isSourceMyFaction.has_value() && isSourceMyFaction.value() == 1) {
+                saveEntry(&AIState::myFaction, targetChar->getCharacterId());
                 myFaction.insert(targetChar->getCharacterId());
+                joinFaction(factionCounts.my);
             } else if (isSourceEnemyFaction.has_value() && isSourceEnemyFaction.value() == 1) {
+                saveEntry(&AIState::enemyFaction, targetChar->getCharacterId());
                 enemyFaction.insert(targetChar->getCharacterId());
+                joinFaction(factionCounts.enemy);
             } else if (isSourceNpcFaction.has_value() && isSourceNpcFaction.value() == 1) {
+                saveEntry(&AIState::npcFaction, targetChar->getCharacterId());
                 npcFaction.insert(targetChar->getCharacterId());
             } else {
+                // source is enemy or npc -> enemy faction may have grown by one
+                factionCounts.enemy.max += factionCounts.enemy.max != std::numeric_limits<unsigned int>::max();
+                factionCounts.npc.min -= factionCounts.npc.min != 0;
                 if (isSourceEnemyFaction.has_value()) {
                     push_back_toUnknownFaction(targetChar->getCharacterId(),
                                                enem,
@@ -652,7 +954,7 @@ namespace libclient::model {
                 }
             }
 
-            characterGadgets.erase(gadgetType);
+            eraseCharacterGadget(gadgetType);
         }
     }
 
@@ -678,12 +980,13 @@ namespace libclient::model {
     void AIState::modifyUsagesLeft(const std::shared_ptr<spy::gadget::Gadget> &gad) {
         gad->setUsagesLeft(gad->getUsagesLeft().value() - 1);
         if (gad->getUsagesLeft() == 0) {
+            saveEntry(&AIState::characterGadgets, gad);
             characterGadgets.erase(gad);
         }
     }
 
     std::optional<double> AIState::hasCharacterGadget(const spy::util::UUID &id, spy::gadget::GadgetEnum type) {
-        auto gad = std::make_shared<spy::gadget::Gadget>(type);
+        const auto &gad = util::GadgetKeys::get(type);
 
         auto charGad = characterGadgets.find(gad);
         if (charGad != characterGadgets.end()) {
@@ -717,6 +1020,97 @@ namespace libclient::model {
         return std::nullopt;
     }
 
+    GadgetOwnership AIState::getGadgetOwnership() const {
+        std::vector<spy::util::UUID> characters;
+        characters.reserve(properties.size());
+        for (const auto &it: properties) {
+            characters.push_back(it.first);
+        }
+        GadgetOwnership ownership(std::move(characters));
+
+        for (const auto &it: characterGadgets) {
+            auto column = ownership.getColumn(it.second);
+            if (column.has_value()) {
+                ownership.setCertain(it.first->getType(), column.value());
+            }
+        }
+
+        for (const auto &gad: floorGadgets) {
+            ownership.setCertain(gad->getType(), ownership.getFloorColumn());
+        }
+
+        std::vector<double> weights(ownership.getNumberOfColumns());
+        for (const auto &it: unknownGadgets) {
+            if (it.second.empty()) {
+                continue;
+            }
+            std::fill(weights.begin(), weights.end(), 0.0);
+            for (const auto &candidate: it.second) {
+                auto column = ownership.getColumn(candidate.first);
+                if (!column.has_value() || candidate.second.empty()) {
+                    continue;
+                }
+                // each certainty entry is a separate observation, use their mean as candidate weight
+                weights[column.value()] = std::accumulate(candidate.second.begin(), candidate.second.end(), 0.0) /
+                                          static_cast<double>(candidate.second.size());
+            }
+            ownership.setRow(it.first->getType(), weights);
+        }
+
+        return ownership;
+    }
+
+    FactionSolution AIState::solveFactions() const {
+        return createFactionSolver().solve();
+    }
+
+    FactionSolver AIState::createFactionSolver() const {
+        using spy::character::FactionEnum;
+
+        FactionSolver solver(factionCounts);
+        for (const auto &it: properties) {
+            const auto &id = it.first;
+            solver.addCharacter(id);
+            if (myFaction.find(id) != myFaction.end()) {
+                solver.setFaction(id, FactionEnum::PLAYER1);
+            } else if (enemyFaction.find(id) != enemyFaction.end()) {
+                solver.setFaction(id, FactionEnum::PLAYER2);
+            } else if (npcFaction.find(id) != npcFaction.end()) {
+                solver.setFaction(id, FactionEnum::NEUTRAL);
+            }
+        }
+        for (const auto &it: excludedFactions) {
+            for (auto faction: it.second) {
+                solver.excludeFaction(it.first, faction);
+            }
+        }
+
+        return solver;
+    }
+
+    unsigned int AIState::propagateFactionConstraints() {
+        auto solution = solveFactions();
+        if (!solution.consistent) {
+            return 0;
+        }
+
+        unsigned int moved = 0;
+        for (const auto &[id, faction]: solution.forced) {
+            switch (faction) {
+                case spy::character::FactionEnum::PLAYER1:
+                    moved += addFaction(id, myFaction);
+                    break;
+                case spy::character::FactionEnum::PLAYER2:
+                    moved += addFaction(id, enemyFaction);
+                    break;
+                default:
+                    moved += addFaction(id, npcFaction);
+                    break;
+            }
+        }
+        return moved;
+    }
+
     std::optional<double> AIState::hasCharacterFaction(const spy::util::UUID &id, spy::character::FactionEnum faction,
                                                        spy::character::FactionEnum me) {
         if (faction == spy::character::FactionEnum::INVALID) {
@@ -766,6 +1160,9 @@ namespace libclient::model {
     }
 
     bool AIState::hasCharacterProperty(const spy::util::UUID &id, spy::character::PropertyEnum prop) {
+        if (properties.find(id) == properties.end()) {
+            saveEntry(&AIState::properties, id);
+        }
         auto p = std::find(properties[id].begin(), properties[id].end(), prop);
         return p != properties[id].end();
     }
@@ -775,6 +1172,7 @@ namespace libclient::model {
         auto keyInMap = unknownFaction.find(key);
         if (keyInMap != unknownFaction.end()) {
             // faction of character with id key is unknown
+            saveEntry(&AIState::unknownFaction, key);
             auto valInMap = std::find_if(keyInMap->second.begin(), keyInMap->second.end(),
                                          [&val](const std::pair<spy::character::FactionEnum, std::vector<double>> &p) {
                                              return p.first == val;
@@ -789,11 +1187,12 @@ namespace libclient::model {
         }
     }
 
-    void AIState::push_back_toUnknownGadgets(std::shared_ptr<spy::gadget::Gadget> key, const spy::util::UUID &val,
-                                             double certainty) {
+    void AIState::push_back_toUnknownGadgets(const std::shared_ptr<const spy::gadget::Gadget> &key,
+                                             const spy::util::UUID &val, double certainty) {
         auto keyInMap = unknownGadgets.find(key);
         if (keyInMap != unknownGadgets.end()) {
             // gadget location is unknown
+            saveEntry(&AIState::unknownGadgets, key);
             auto valInMap = std::find_if(keyInMap->second.begin(), keyInMap->second.end(),
                                          [&val](const std::pair<spy::util::UUID, std::vector<double>> &p) {
                                              return p.first == val;
@@ -802,13 +1201,13 @@ namespace libclient::model {
                 // certainty for value already in map
                 valInMap->second.push_back(certainty);
             } else {
-                unknownGadgets[key].push_back(std::pair<spy::util::UUID, std::vector<double>>(val, {certainty}));
+                keyInMap->second.push_back(std::pair<spy::util::UUID, std::vector<double>>(val, {certainty}));
             }
         }
     }
 
-    unsigned int AIState::safePosToIndex(const spy::gameplay::State &s, const spy::util::Point &p) {
-        return p.y + p.x * s.getMap().getNumberOfRows();
+    std::optional<unsigned int> AIState::safePosToIndex(const spy::util::Point &p) const {
+        return safes.getIndex(p);
     }
 
 }
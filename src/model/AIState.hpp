@@ -16,8 +16,39 @@
 #include <datatypes/matchconfig/MatchConfig.hpp>
 #include <datatypes/gameplay/PropertyAction.hpp>
 #include <datatypes/gameplay/SpyAction.hpp>
+#include <model/GadgetOwnership.hpp>
+#include <model/FactionSolver.hpp>
+#include <model/SafeRegistry.hpp>
+#include <model/CharacterGrid.hpp>
+#include <util/GameLogicUtils.hpp>
+#include <functional>
+#include <optional>
 
 namespace libclient::model {
+
+    /**
+     * result of AIState::benchmark, allocations are 0 if LibClientAllocHook is not linked
+     */
+    struct ProcessingStatistics {
+        std::size_t batches = 0;
+        double secondsPerBatch = 0;
+        double allocationsPerBatch = 0;
+        double bytesPerBatch = 0;
+    };
+
+    /**
+     * result of AIState::benchmarkCheckpoints, copy is the cost of the former full copy of the AIState per checkpoint
+     */
+    struct CheckpointStatistics {
+        std::size_t checkpoints = 0;
+        double secondsPerCheckpoint = 0;
+        double secondsPerRollback = 0; // undoing one batch of operations
+        double secondsPerCopy = 0;
+        double undoEntriesPerBatch = 0;
+        double allocationsPerCheckpoint = 0;
+        double allocationsPerCopy = 0;
+    };
+
     class AIState {
         public:
             // double is percentage to show how sure one is
@@ -25,6 +56,9 @@ namespace libclient::model {
             std::set<spy::util::UUID> myFaction; // set by RequestEquipmentChoice message
             std::set<spy::util::UUID> enemyFaction; // set during game
             std::set<spy::util::UUID> npcFaction; // set during game
+            // factions (PLAYER1 if my, PLAYER2 if enemy, NEUTRAL if npc) a character of unknownFaction is known not to have
+            std::map<spy::util::UUID, std::set<spy::character::FactionEnum>> excludedFactions; // set by processOperation (e.g. failed nugget), cleared by addFaction
+            FactionCounts factionCounts; // my faction set by RequestEquipmentChoice message, others by client
 
             // double is percentage to show how sure one is
             std::map<std::shared_ptr<spy::gadget::Gadget>, std::vector<std::pair<spy::util::UUID, std::vector<double>>>, util::cmpGadgetPtr> unknownGadgets; // initially set by HelloReply message
@@ -46,11 +80,14 @@ namespace libclient::model {
             std::set<unsigned int> safeCombinations;
             std::set<unsigned int> openedSafesTotal;
             std::set<spy::util::UUID> combinationsFromNpcs;
+            SafeRegistry safes; // set by HelloReply message, indices of the sets above are registry indices
 
             /**
              * applies all lists without "unknown" in name to current state
              * @param s current state
              * @param me FactionEnum of my faction
+             * @note every GameStatus message replaces the state by the one of the server, which carries none of the
+             *       facts, so all of them are applied every time (linear in characters and known gadgets)
              */
             void
             applySureInformation(spy::gameplay::State &s, spy::character::FactionEnum me); // done by GameStatus message
@@ -58,7 +95,7 @@ namespace libclient::model {
             /**
              * moves character id from unknownFaction list to specified faction list
              * @param id id of character to be set
-             * @param factionList list that character should be moved to
+             * @param factionList list that character should be moved to (myFaction, enemyFaction or npcFaction)
              * @return true if method was successful
              */
             bool addFaction(const spy::util::UUID &id, std::set<spy::util::UUID> &factionList);
@@ -71,16 +108,39 @@ namespace libclient::model {
              */
             bool addGadget(spy::gadget::GadgetEnum gadgetType, const std::optional<spy::util::UUID> &id);
 
+            /**
+             * adds own gadget object of every gadget type not yet in unknownGadgets list to it
+             */
+            void addUnknownGadgets(); // done by HelloReply message or LibClient::setConfigs
+
+            /**
+             * @param type gadget type
+             * @return true if gadget is in floorGadgets list
+             */
+            [[nodiscard]] bool isGadgetOnFloor(spy::gadget::GadgetEnum type) const;
+
             /**
             * processes single operation into state lists/maps/...
-            * @param operation operation to be processed
+            * @param operation operation to be processed (only borrowed)
             * @param s state without operation applied
             * @param config match config
             */
-            void processOperation(std::shared_ptr<const spy::gameplay::BaseOperation> operation,
+            void processOperation(const spy::gameplay::BaseOperation &operation,
                                   const spy::gameplay::State &s, const spy::MatchConfig &config,
                                   spy::character::FactionEnum me); // done by GameStatus message
 
+            /**
+             * processes all operations of one GameStatus message, gadgets held by characters in s are taken over
+             * once before the operations (instead of applySureInformation after every single operation)
+             * @param operations operations to be processed in order
+             * @param s state without operations applied
+             * @param config match config
+             * @param me FactionEnum of my faction
+             */
+            void processOperations(const std::vector<std::shared_ptr<const spy::gameplay::BaseOperation>> &operations,
+                                   const spy::gameplay::State &s, const spy::MatchConfig &config,
+                                   spy::character::FactionEnum me); // done by GameStatus message
+
             /**
              * find out how certain it is that given character has given faction
              * @param id id of the character to be searched for
@@ -100,29 +160,199 @@ namespace libclient::model {
             std::optional<double> hasCharacterGadget(const spy::util::UUID &id, spy::gadget::GadgetEnum type);
 
             /**
-             * calculate unique index for safe
-             * @param s current state
+             * builds ownership distribution of all gadgets in one pass, the mean certainty of each candidate is its
+             * probability, the rest of the row is unassigned (only rows whose candidates sum up to more than 1 are
+             * normalized)
+             * @return matrix gadget types x (characters known from properties + floor + unassigned)
+             */
+            [[nodiscard]] GadgetOwnership getGadgetOwnership() const;
+
+            /**
+             * solves faction assignment of all characters under factionCounts, faction lists and excludedFactions
+             * @return exact probabilities per character and characters whose faction is forced
+             */
+            [[nodiscard]] FactionSolution solveFactions() const;
+
+            /**
+             * creates solver containing all characters and constraints known to AIState
+             * @return solver, characters are in order of properties
+             */
+            [[nodiscard]] FactionSolver createFactionSolver() const;
+
+            /**
+             * moves characters whose faction is forced by the faction counts from unknownFaction to their faction list
+             * @return number of characters that were moved
+             */
+            unsigned int propagateFactionConstraints(); // done by GameStatus message
+
+            /**
+             * calculate unique index for safe (dense index 0..k-1 from safe registry)
              * @param p position of the safe as Point
-             * @return index for the safe at position p
+             * @return index for the safe at position p, nullopt if safe registry is not built or there is no safe at p
              */
-            unsigned int safePosToIndex(const spy::gameplay::State &s, const spy::util::Point &p);
+            [[nodiscard]] std::optional<unsigned int> safePosToIndex(const spy::util::Point &p) const;
+
+            /**
+             * starts recording changes, operations processed afterwards can be undone with rollback, checkpoints can
+             * be nested
+             * @note only the usages of the gadgets in the lists are saved (they are modified in place), everything
+             *       else is restored from the undo log the member functions write while a checkpoint exists, direct
+             *       writes to the public members are not recorded
+             */
+            void checkpoint();
+
+            /**
+             * undoes all changes since the last checkpoint and removes it
+             * @return false if there is no checkpoint
+             */
+            bool rollback();
+
+            /**
+             * removes last checkpoint and keeps current beliefs (an outer checkpoint can still undo them)
+             * @return false if there is no checkpoint
+             */
+            bool commit();
+
+            [[nodiscard]] std::size_t getNumberOfCheckpoints() const;
+
+            /**
+             * @return true if a member function recorded a change since the last checkpoint (may be true although
+             *         the recorded value did not change), false without checkpoint
+             */
+            [[nodiscard]] bool changedSinceCheckpoint() const;
+
+            /**
+             * copies AIState with own gadget objects, speculative updates of the copy never change this AIState
+             * @return copy without checkpoints
+             */
+            [[nodiscard]] AIState fork() const;
+
+            /**
+             * processes the operations of one GameStatus message repeatedly, every repetition on a new fork of this
+             * AIState (forking is neither timed nor counted)
+             * @param operations operations to be processed in order
+             * @param s state without operations applied
+             * @param config match config
+             * @param me FactionEnum of my faction
+             * @param repetitions number of repetitions
+             * @return time and heap allocations per batch of operations
+             */
+            [[nodiscard]] ProcessingStatistics
+            benchmark(const std::vector<std::shared_ptr<const spy::gameplay::BaseOperation>> &operations,
+                      const spy::gameplay::State &s, const spy::MatchConfig &config, spy::character::FactionEnum me,
+                      std::size_t repetitions) const;
+
+            /**
+             * processes the operations of one GameStatus message repeatedly between checkpoint and rollback on a fork
+             * of this AIState, compares the checkpoint with a full copy of the AIState
+             * @param operations operations to be processed in order
+             * @param s state without operations applied
+             * @param config match config
+             * @param me FactionEnum of my faction
+             * @param repetitions number of repetitions
+             * @return time and heap allocations per checkpoint, rollback and copy
+             */
+            [[nodiscard]] CheckpointStatistics
+            benchmarkCheckpoints(const std::vector<std::shared_ptr<const spy::gameplay::BaseOperation>> &operations,
+                                 const spy::gameplay::State &s, const spy::MatchConfig &config,
+                                 spy::character::FactionEnum me, std::size_t repetitions) const;
 
         private:
+            struct Checkpoint;
+            std::vector<Checkpoint> checkpoints;
+            std::vector<std::function<void(AIState &)>> undoLog; // changes since the first checkpoint, newest last
+
+            /**
+             * records current value of a member, no-op without checkpoint
+             * @param member member that is about to change
+             */
+            template<typename T>
+            void saveMember(T AIState::*member) {
+                if (!checkpoints.empty()) {
+                    undoLog.emplace_back([member, old = this->*member](AIState &self) {
+                        self.*member = old;
+                    });
+                }
+            }
+
+            /**
+             * records current entry (or its absence) of a map or set, no-op without checkpoint
+             * @param member map or set whose entry is about to change
+             * @param key key of the entry
+             */
+            template<typename Container, typename Key>
+            void saveEntry(Container AIState::*member, const Key &key) {
+                if (checkpoints.empty()) {
+                    return;
+                }
+                const auto &container = this->*member;
+                auto it = container.find(key);
+                std::optional<typename Container::value_type> old;
+                if (it != container.end()) {
+                    old.emplace(*it);
+                }
+                undoLog.emplace_back([member, key, old = std::move(old)](AIState &self) {
+                    auto &c = self.*member;
+                    auto current = c.find(key);
+                    if (current != c.end()) {
+                        c.erase(current);
+                    }
+                    if (old.has_value()) {
+                        c.insert(old.value());
+                    }
+                });
+            }
+
+            CharacterGrid characterGrid; // built for state of the batch in processOperations
+            bool characterGridValid = false;
+
+            /**
+             * finds character on field, in O(1) while a batch of operations is processed
+             * @param s state the operation is applied to
+             * @param p position
+             * @return iterator to character in s, s.getCharacters().end() if field is empty
+             */
+            [[nodiscard]] auto findCharacterAt(const spy::gameplay::State &s, const spy::util::Point &p) const {
+                return characterGridValid ? characterGrid.find(s.getCharacters(), p)
+                                          : spy::util::GameLogicUtils::findInCharacterSetByCoordinates(
+                                s.getCharacters(), p);
+            }
+
+            /**
+             * adds faction to excludedFactions of character if its faction is still unknown
+             * @param id id of character
+             * @param faction PLAYER1 if my, PLAYER2 if enemy, NEUTRAL if npc
+             * @return true if character is in unknownFaction
+             */
+            bool excludeFaction(const spy::util::UUID &id, spy::character::FactionEnum faction);
+
+            /**
+             * moves gadgets held by characters in state to characterGadgets list (for characters holding known gadgets)
+             * @param s current state
+             */
+            void takeGadgetsFromState(const spy::gameplay::State &s);
+
             /**
              * moves gadget to characterGadgets list
              * @param gadgetType gadget representing type to be added to character (do not add this gadget but gadget from other list)
              * @param id id of character to move to
              * @return true if method was successful
              */
-            bool
-            addGadgetToCharacter(const std::shared_ptr<spy::gadget::Gadget> &gadgetType, const spy::util::UUID &id);
+            bool addGadgetToCharacter(const std::shared_ptr<const spy::gadget::Gadget> &gadgetType,
+                                      const spy::util::UUID &id);
 
             /**
              * moves gadget to floorGadgets list
              * @param gadgetType gadget representing type to be added to floor (do not add this gadget but gadget from other list)
              * @return true if method was successful
              */
-            bool addGadgetToFloor(const std::shared_ptr<spy::gadget::Gadget> &gadgetType);
+            bool addGadgetToFloor(const std::shared_ptr<const spy::gadget::Gadget> &gadgetType);
+
+            /**
+             * removes gadget from characterGadgets list (e.g. used up)
+             * @param gadgetType gadget representing type to be removed
+             */
+            void eraseCharacterGadget(const std::shared_ptr<const spy::gadget::Gadget> &gadgetType);
 
             /**
              * processes single gadget action into state lists/maps/...
@@ -130,7 +360,7 @@ namespace libclient::model {
              * @param s state without gadget action applied
              * @param config match config
              */
-            void processGadgetAction(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+            void processGadgetAction(const spy::gameplay::GadgetAction &action,
                                      const spy::gameplay::State &s, const spy::MatchConfig &config,
                                      spy::character::FactionEnum me);
 
@@ -140,7 +370,7 @@ namespace libclient::model {
              * @param s state without gadget action applied
              * @param config match config
              */
-            void processSpyAction(std::shared_ptr<const spy::gameplay::SpyAction> operation,
+            void processSpyAction(const spy::gameplay::SpyAction &op,
                                   const spy::gameplay::State &s, const spy::MatchConfig &config,
                                   spy::character::FactionEnum me);
 
@@ -150,41 +380,47 @@ namespace libclient::model {
              * @param s state without gadget action applied
              * @param config match config
              */
-            void processPropertyAction(std::shared_ptr<const spy::gameplay::PropertyAction> op,
+            void processPropertyAction(const spy::gameplay::PropertyAction &op,
                                        const spy::gameplay::State &s);
 
-            void processGadgetGrapple(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+            void processGadgetGrapple(const spy::gameplay::GadgetAction &action,
                                       const spy::gameplay::State &s);
 
-            void processGadgetNugget(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+            void processGadgetNugget(const spy::gameplay::GadgetAction &action,
+                                     const std::shared_ptr<const spy::gadget::Gadget> &gadgetType,
                                      const spy::gameplay::State &s,
                                      spy::character::FactionEnum me);
 
-            void processGadgetBowlerBlade(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+            void processGadgetBowlerBlade(const spy::gameplay::GadgetAction &action,
+                                          const std::shared_ptr<const spy::gadget::Gadget> &gadgetType,
                                           const spy::gameplay::State &s, const spy::MatchConfig &config);
 
-            void processGadgetCocktail(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+            void processGadgetCocktail(const spy::gameplay::GadgetAction &action,
                                        const spy::gameplay::State &s);
 
-            void processGadgetMoledie(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+            void processGadgetMoledie(const spy::gameplay::GadgetAction &action,
+                                      const std::shared_ptr<const spy::gadget::Gadget> &gadgetType,
                                       const spy::gameplay::State &s, const spy::MatchConfig &config);
 
-            void processGadgetLaserCompact(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+            void processGadgetLaserCompact(const spy::gameplay::GadgetAction &action,
                                            const spy::gameplay::State &s);
 
-            void processGadgetPoisonPills(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+            void processGadgetPoisonPills(const spy::gameplay::GadgetAction &action,
+                                          const std::shared_ptr<const spy::gadget::Gadget> &gadgetType,
                                           const spy::gameplay::State &s);
 
-            void processGadgetChickenFeed(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+            void processGadgetChickenFeed(const spy::gameplay::GadgetAction &action,
+                                          const std::shared_ptr<const spy::gadget::Gadget> &gadgetType,
                                           const spy::gameplay::State &s);
 
-            void processGadgetMirrorOfWilderness(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+            void processGadgetMirrorOfWilderness(const spy::gameplay::GadgetAction &action,
+                                                 const std::shared_ptr<const spy::gadget::Gadget> &gadgetType,
                                                  const spy::gameplay::State &s);
 
-            void processGadgetHairdryer(std::shared_ptr<const spy::gameplay::GadgetAction> action,
+            void processGadgetHairdryer(const spy::gameplay::GadgetAction &action,
                                         const spy::gameplay::State &s);
 
-            void processGettingRidOfMoledie(std::shared_ptr<const spy::gameplay::BaseOperation> operation);
+            void processGettingRidOfMoledie(const spy::gameplay::BaseOperation &operation);
 
             /**
              * get faction of character according to AIState
@@ -203,12 +439,20 @@ namespace libclient::model {
 
             void modifyUsagesLeft(const std::shared_ptr<spy::gadget::Gadget> &gad);
 
-            void push_back_toUnknownGadgets(std::shared_ptr<spy::gadget::Gadget> key, const spy::util::UUID &val,
-                                            double certainty);
+            void push_back_toUnknownGadgets(const std::shared_ptr<const spy::gadget::Gadget> &key,
+                                            const spy::util::UUID &val, double certainty);
 
             void
             push_back_toUnknownFaction(const spy::util::UUID &key, spy::character::FactionEnum val, double certainty);
     };
+
+    /**
+     * start of the changes in the undo log, gadgets are changed in place -> their usages are saved separately
+     */
+    struct AIState::Checkpoint {
+        std::size_t undoLogSize;
+        std::vector<std::pair<std::shared_ptr<spy::gadget::Gadget>, unsigned int>> usages;
+    };
 }
 
 
@@ -0,0 +1,239 @@
+/**
+ * @file   BeliefSampler.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the particle filter drawing determinizations of the hidden state from AIState.
+ */
+
+#include "BeliefSampler.hpp"
+
+namespace libclient::model {
+
+    BeliefSampler::BeliefSampler(std::size_t particleCount, std::size_t numberOfThreads, std::uint64_t seed)
+            : numberOfParticles(particleCount), pool(numberOfThreads), generator(seed) {
+        for (std::size_t i = 0; i < pool.getNumberOfThreads(); i++) {
+            generators.emplace_back(seed + i + 1);
+        }
+    }
+
+    bool BeliefSampler::reset(const AIState &ai) {
+        beliefs = snapshot(ai);
+        particles.clear();
+        if (!beliefs.factions.consistent) {
+            return false;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        particles.resize(numberOfParticles);
+        pool.parallelFor(numberOfParticles, [this](std::size_t begin, std::size_t end, std::size_t chunk) {
+            drawRange(begin, end, generators.at(chunk));
+        });
+        recordStatistics(false, numberOfParticles, start);
+        normalizeWeights();
+        return true;
+    }
+
+    bool BeliefSampler::update(const AIState &ai) {
+        auto newBeliefs = snapshot(ai);
+        if (particles.empty() || !newBeliefs.factions.consistent ||
+            newBeliefs.factions.characters != beliefs.factions.characters) {
+            // nothing to reweight (or characters changed) -> start from scratch
+            return reset(ai);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        auto oldBeliefs = std::move(beliefs);
+        beliefs = std::move(newBeliefs);
+
+        pool.parallelFor(particles.size(), [this, &oldBeliefs](std::size_t begin, std::size_t end, std::size_t chunk) {
+            auto &rng = generators.at(chunk);
+            for (auto i = begin; i < end; i++) {
+                particles[i].weight *= reweight(particles[i].world, oldBeliefs, rng);
+            }
+        });
+        normalizeWeights();
+
+        if (getEffectiveSampleSize() < resampleThreshold * static_cast<double>(numberOfParticles)) {
+            resample();
+        }
+        recordStatistics(true, particles.size(), start);
+        return true;
+    }
+
+    std::optional<Determinization> BeliefSampler::draw() {
+        if (particles.empty()) {
+            return std::nullopt;
+        }
+        double r = std::uniform_real_distribution<double>(0, 1)(generator);
+        for (const auto &p: particles) {
+            if (r < p.weight) {
+                return p.world;
+            }
+            r -= p.weight;
+        }
+        return particles.back().world;
+    }
+
+    const std::vector<Particle> &BeliefSampler::getParticles() const {
+        return particles;
+    }
+
+    const std::vector<spy::util::UUID> &BeliefSampler::getCharacters() const {
+        return beliefs.factions.characters;
+    }
+
+    const GadgetOwnership &BeliefSampler::getGadgetOwnership() const {
+        return beliefs.gadgets;
+    }
+
+    double BeliefSampler::getEffectiveSampleSize() const {
+        double sumOfSquares = 0;
+        for (const auto &p: particles) {
+            sumOfSquares += p.weight * p.weight;
+        }
+        return sumOfSquares > 0 ? 1 / sumOfSquares : 0;
+    }
+
+    const SamplerStatistics &BeliefSampler::getStatistics() const {
+        return statistics;
+    }
+
+    void BeliefSampler::setResampleThreshold(double ratio) {
+        resampleThreshold = ratio;
+    }
+
+    BeliefSampler::Beliefs BeliefSampler::snapshot(const AIState &ai) {
+        Beliefs b;
+        b.solver = std::make_unique<FactionSolver>(ai.createFactionSolver());
+        b.samplingTable = b.solver->getSamplingTable();
+        b.factions = b.solver->solve();
+        b.gadgets = ai.getGadgetOwnership();
+        return b;
+    }
+
+    void BeliefSampler::drawRange(std::size_t begin, std::size_t end, std::mt19937_64 &rng) {
+        std::uniform_real_distribution<double> uniform(0, 1);
+        auto random = [&rng, &uniform]() { return uniform(rng); };
+
+        for (auto i = begin; i < end; i++) {
+            auto &world = particles[i].world;
+            beliefs.solver->sample(random, beliefs.samplingTable, world.factions);
+            world.gadgetOwners.resize(GadgetOwnership::numberOfGadgetTypes);
+            for (std::size_t g = 0; g < GadgetOwnership::numberOfGadgetTypes; g++) {
+                world.gadgetOwners[g] = drawGadgetOwner(beliefs.gadgets, spy::gadget::GadgetEnum(g + 1), rng);
+            }
+            particles[i].weight = 1;
+        }
+    }
+
+    std::size_t BeliefSampler::drawGadgetOwner(const GadgetOwnership &gadgets, spy::gadget::GadgetEnum type,
+                                               std::mt19937_64 &rng) {
+        if (!gadgets.hasInformation(type)) {
+            return Determinization::noOwner;
+        }
+        const double *row = gadgets.getRow(type);
+        double r = std::uniform_real_distribution<double>(0, 1)(rng);
+        std::size_t last = Determinization::noOwner;
+        for (std::size_t c = 0; c < gadgets.getNumberOfColumns(); c++) {
+            if (row[c] <= 0) {
+                continue;
+            }
+            if (r < row[c]) {
+                return c;
+            }
+            r -= row[c];
+            last = c;
+        }
+        return last;
+    }
+
+    double BeliefSampler::reweight(Determinization &world, const Beliefs &oldBeliefs, std::mt19937_64 &rng) const {
+        // factions are not independent (faction sizes) -> ratio of joint probabilities, for uniform weights this is
+        // old number / new number of consistent assignments
+        double newWeight = beliefs.solver->getWeight(world.factions);
+        double oldWeight = oldBeliefs.solver->getWeight(world.factions);
+        if (newWeight <= 0 || oldWeight <= 0) {
+            return 0;
+        }
+        double ratio = (newWeight / beliefs.factions.total) / (oldWeight / oldBeliefs.factions.total);
+
+        for (std::size_t g = 0; g < world.gadgetOwners.size(); g++) {
+            auto type = spy::gadget::GadgetEnum(g + 1);
+            auto &owner = world.gadgetOwners[g];
+            if (owner == Determinization::noOwner || !oldBeliefs.gadgets.hasInformation(type)) {
+                // gadget was unknown -> draw from current beliefs, does not change weight
+                owner = drawGadgetOwner(beliefs.gadgets, type, rng);
+                continue;
+            }
+            if (!beliefs.gadgets.hasInformation(type)) {
+                // gadget disappeared
+                owner = Determinization::noOwner;
+                continue;
+            }
+            double p = beliefs.gadgets.getRow(type)[owner];
+            if (p <= 0) {
+                return 0;
+            }
+            ratio *= p / oldBeliefs.gadgets.getRow(type)[owner];
+        }
+
+        return ratio;
+    }
+
+    void BeliefSampler::normalizeWeights() {
+        double sum = 0;
+        for (const auto &p: particles) {
+            sum += p.weight;
+        }
+        if (sum <= 0) {
+            return;
+        }
+        for (auto &p: particles) {
+            p.weight /= sum;
+        }
+    }
+
+    void BeliefSampler::recordStatistics(bool update, std::size_t samples,
+                                         std::chrono::steady_clock::time_point start) {
+        std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+        statistics.update = update;
+        statistics.samples = samples;
+        statistics.seconds = duration.count();
+        statistics.threads = pool.getNumberOfThreads();
+        statistics.samplesPerSecondPerCore = statistics.seconds > 0
+                                             ? static_cast<double>(statistics.samples) / statistics.seconds /
+                                               static_cast<double>(statistics.threads)
+                                             : 0;
+    }
+
+    void BeliefSampler::resample() {
+        std::vector<Particle> resampled;
+        resampled.reserve(numberOfParticles);
+
+        double step = 1 / static_cast<double>(numberOfParticles);
+        double position = std::uniform_real_distribution<double>(0, step)(generator);
+        double cumulative = 0;
+        for (const auto &p: particles) {
+            cumulative += p.weight;
+            while (position < cumulative && resampled.size() < numberOfParticles) {
+                resampled.push_back({p.world, step});
+                position += step;
+            }
+        }
+
+        // population without weight or rounding errors -> refill with fresh draws
+        auto drawn = resampled.size();
+        particles = std::move(resampled);
+        if (drawn < numberOfParticles) {
+            particles.resize(numberOfParticles);
+            pool.parallelFor(numberOfParticles - drawn,
+                             [this, drawn](std::size_t begin, std::size_t end, std::size_t chunk) {
+                                 drawRange(drawn + begin, drawn + end, generators.at(chunk));
+                             });
+        }
+        for (auto &p: particles) {
+            p.weight = 1;
+        }
+        normalizeWeights();
+    }
+}
@@ -0,0 +1,159 @@
+/**
+ * @file   BeliefSampler.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the particle filter drawing determinizations of the hidden state from AIState.
+ */
+
+#ifndef LIBCLIENT_BELIEFSAMPLER_HPP
+#define LIBCLIENT_BELIEFSAMPLER_HPP
+
+#include <chrono>
+#include <random>
+#include <memory>
+#include <model/AIState.hpp>
+#include <util/ThreadPool.hpp>
+
+namespace libclient::model {
+
+    /**
+     * one possible world consistent with AIState
+     * factions are relative to the client (PLAYER1 if my, PLAYER2 if enemy, NEUTRAL if npc)
+     */
+    struct Determinization {
+        static constexpr std::size_t noOwner = std::numeric_limits<std::size_t>::max();
+
+        // faction per character in order of BeliefSampler::getCharacters()
+        std::vector<spy::character::FactionEnum> factions;
+        // owner column per gadget type (index type - 1) as in GadgetOwnership, noOwner if gadget is not in game
+        std::vector<std::size_t> gadgetOwners;
+    };
+
+    struct Particle {
+        Determinization world;
+        double weight = 0;
+    };
+
+    /**
+     * throughput of the last call of reset (particles drawn) or update (particles reweighted and resampled)
+     */
+    struct SamplerStatistics {
+        bool update = false; // true if measured by update
+        std::size_t samples = 0;
+        double seconds = 0;
+        std::size_t threads = 0;
+        double samplesPerSecondPerCore = 0;
+    };
+
+    /**
+     * particle filter over the hidden state (factions, gadget owners), poisoned cocktails are sure information
+     * and are taken from AIState directly
+     * particles are drawn from the exact faction distribution (FactionSolver) and the gadget ownership matrix
+     */
+    class BeliefSampler {
+        public:
+            /**
+             * @param numberOfParticles size of particle population
+             * @param numberOfThreads number of worker threads, 0 uses all cores
+             * @param seed seed of the random number generators
+             */
+            explicit BeliefSampler(std::size_t numberOfParticles, std::size_t numberOfThreads = 0,
+                                   std::uint64_t seed = std::random_device{}());
+
+            /**
+             * draws completely new particle population from current beliefs
+             * @param ai current AIState
+             * @return false if beliefs are inconsistent (population is empty then)
+             */
+            bool reset(const AIState &ai);
+
+            /**
+             * reweights particles after AIState processed new operations, particles contradicting sure information
+             * get weight 0, population is resampled and refilled from current beliefs if it degenerated
+             * @param ai current AIState
+             * @return false if beliefs are inconsistent (population is empty then)
+             */
+            bool update(const AIState &ai);
+
+            /**
+             * draws particle according to weights
+             * @return determinization, nullopt if population is empty
+             */
+            [[nodiscard]] std::optional<Determinization> draw();
+
+            [[nodiscard]] const std::vector<Particle> &getParticles() const;
+
+            [[nodiscard]] const std::vector<spy::util::UUID> &getCharacters() const;
+
+            /**
+             * @return ownership matrix the gadget owners of the particles were drawn from (columns of gadgetOwners)
+             */
+            [[nodiscard]] const GadgetOwnership &getGadgetOwnership() const;
+
+            /**
+             * @return effective sample size of the current weights
+             */
+            [[nodiscard]] double getEffectiveSampleSize() const;
+
+            [[nodiscard]] const SamplerStatistics &getStatistics() const;
+
+            /**
+             * @param ratio population is resampled if effective sample size drops below ratio * numberOfParticles
+             */
+            void setResampleThreshold(double ratio);
+
+        private:
+            /**
+             * snapshot of AIState beliefs used for drawing and weighting
+             */
+            struct Beliefs {
+                std::unique_ptr<FactionSolver> solver;
+                std::vector<double> samplingTable;
+                FactionSolution factions;
+                GadgetOwnership gadgets;
+            };
+
+            std::size_t numberOfParticles;
+            double resampleThreshold = 0.5;
+            util::ThreadPool pool;
+            std::vector<std::mt19937_64> generators;
+            std::mt19937_64 generator;
+            std::vector<Particle> particles;
+            Beliefs beliefs;
+            SamplerStatistics statistics;
+
+            [[nodiscard]] static Beliefs snapshot(const AIState &ai);
+
+            /**
+             * draws particles [begin, end) from beliefs with weight 1
+             */
+            void drawRange(std::size_t begin, std::size_t end, std::mt19937_64 &rng);
+
+            /**
+             * draws owner of gadget from its row in the ownership matrix
+             * @return column of owner, Determinization::noOwner if nothing is known about gadget
+             */
+            [[nodiscard]] static std::size_t drawGadgetOwner(const GadgetOwnership &gadgets,
+                                                             spy::gadget::GadgetEnum type, std::mt19937_64 &rng);
+
+            /**
+             * updates particle from old beliefs to current beliefs, gadgets that were unknown before are drawn
+             * factions are weighted by their joint probability (weight of assignment / weighted number of consistent
+             * assignments), gadget owners by their rows as they are drawn independently
+             * @return likelihood ratio new beliefs / old beliefs of the particle, 0 if world contradicts new beliefs
+             */
+            [[nodiscard]] double reweight(Determinization &world, const Beliefs &oldBeliefs,
+                                          std::mt19937_64 &rng) const;
+
+            void normalizeWeights();
+
+            void recordStatistics(bool update, std::size_t samples, std::chrono::steady_clock::time_point start);
+
+            /**
+             * systematic resampling, particles with weight 0 are replaced by fresh draws
+             */
+            void resample();
+    };
+}
+
+#endif //LIBCLIENT_BELIEFSAMPLER_HPP
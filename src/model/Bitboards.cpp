@@ -0,0 +1,155 @@
+/**
+ * @file   Bitboards.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the bitboard layers derived from the map of the state.
+ */
+
+#include "Bitboards.hpp"
+#include <util/MemoryUtils.hpp>
+
+namespace libclient::model {
+
+    void Bitboards::update(const spy::gameplay::State &s) {
+        using spy::scenario::FieldStateEnum;
+
+        const auto &rows = s.getMap().getMap();
+        util::FieldIndexer newIndexer(rows);
+        if (newIndexer != indexer) {
+            indexer = newIndexer;
+            notFirstColumn = makeSet();
+            notLastColumn = makeSet();
+            auto width = indexer.getWidth();
+            for (std::size_t i = 0; i < indexer.getNumberOfFields(); i++) {
+                notFirstColumn.set(i, i % width != 0);
+                notLastColumn.set(i, i % width != width - 1);
+            }
+        }
+
+        for (auto &layer: layers) {
+            layer = makeSet();
+        }
+        auto set = [this](BitboardLayer layer, std::size_t index) {
+            layers[static_cast<std::size_t>(layer)].set(index);
+        };
+
+        for (auto y = 0U; y < rows.size(); y++) {
+            for (auto x = 0U; x < rows[y].size(); x++) {
+                const auto &field = rows[y][x];
+                auto index = indexer.getIndex(x, y);
+                switch (field.getFieldState()) {
+                    case FieldStateEnum::WALL:
+                        set(BitboardLayer::WALL, index);
+                        break;
+                    case FieldStateEnum::FREE:
+                        set(BitboardLayer::FREE, index);
+                        break;
+                    case FieldStateEnum::BAR_TABLE:
+                        set(BitboardLayer::BAR_TABLE, index);
+                        break;
+                    case FieldStateEnum::BAR_SEAT:
+                        set(BitboardLayer::BAR_SEAT, index);
+                        break;
+                    case FieldStateEnum::SAFE:
+                        set(BitboardLayer::SAFE, index);
+                        break;
+                    case FieldStateEnum::ROULETTE_TABLE:
+                        set(BitboardLayer::ROULETTE_TABLE, index);
+                        break;
+                    case FieldStateEnum::FIREPLACE:
+                        set(BitboardLayer::FIREPLACE, index);
+                        break;
+                    default:
+                        break;
+                }
+                if (field.isFoggy()) {
+                    set(BitboardLayer::FOG, index);
+                }
+                if (field.getGadget().has_value()) {
+                    set(BitboardLayer::GADGET, index);
+                }
+            }
+        }
+
+        for (const auto &c: s.getCharacters()) {
+            if (c.getCoordinates().has_value()) {
+                auto index = getIndex(c.getCoordinates().value());
+                if (index.has_value()) {
+                    set(BitboardLayer::OCCUPIED, index.value());
+                }
+            }
+        }
+    }
+
+    std::size_t Bitboards::getWidth() const {
+        return indexer.getWidth();
+    }
+
+    std::size_t Bitboards::getHeight() const {
+        return indexer.getHeight();
+    }
+
+    const util::Bitset &Bitboards::get(BitboardLayer layer) const {
+        return layers.at(static_cast<std::size_t>(layer));
+    }
+
+    bool Bitboards::test(BitboardLayer layer, const spy::util::Point &p) const {
+        auto index = getIndex(p);
+        return index.has_value() && get(layer).test(index.value());
+    }
+
+    util::Bitset Bitboards::getWalkable() const {
+        return get(BitboardLayer::FREE) | get(BitboardLayer::BAR_SEAT);
+    }
+
+    util::Bitset Bitboards::makeSet() const {
+        return util::Bitset(indexer.getNumberOfFields());
+    }
+
+    util::Bitset Bitboards::expand(const util::Bitset &fields) const {
+        // horizontal neighbours first, then the three rows at once
+        auto horizontal = fields | ((fields << 1) & notFirstColumn) | ((fields >> 1) & notLastColumn);
+        return horizontal | (horizontal << indexer.getWidth()) | (horizontal >> indexer.getWidth());
+    }
+
+    util::Bitset Bitboards::getNeighbours(const spy::util::Point &p) const {
+        auto fields = makeSet();
+        auto index = getIndex(p);
+        if (!index.has_value()) {
+            return fields;
+        }
+        fields.set(index.value());
+        auto neighbours = expand(fields);
+        neighbours.reset(index.value());
+        return neighbours;
+    }
+
+    std::optional<std::size_t> Bitboards::getIndex(const spy::util::Point &p) const {
+        return indexer.getIndex(p);
+    }
+
+    spy::util::Point Bitboards::getPoint(std::size_t index) const {
+        return indexer.getPoint(index);
+    }
+
+    const util::FieldIndexer &Bitboards::getIndexer() const {
+        return indexer;
+    }
+
+    std::vector<spy::util::Point> Bitboards::toPoints(const util::Bitset &fields) const {
+        std::vector<spy::util::Point> points;
+        points.reserve(fields.count());
+        fields.forEach([this, &points](std::size_t index) {
+            points.push_back(getPoint(index));
+        });
+        return points;
+    }
+
+    std::size_t Bitboards::getSizeInBytes() const {
+        auto size = util::capacityInBytes(notFirstColumn.getWords()) + util::capacityInBytes(notLastColumn.getWords());
+        for (const auto &layer: layers) {
+            size += util::capacityInBytes(layer.getWords());
+        }
+        return size;
+    }
+}
@@ -0,0 +1,107 @@
+/**
+ * @file   Bitboards.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the bitboard layers derived from the map of the state.
+ */
+
+#ifndef LIBCLIENT_BITBOARDS_HPP
+#define LIBCLIENT_BITBOARDS_HPP
+
+#include <array>
+#include <optional>
+#include <datatypes/gameplay/State.hpp>
+#include <util/Bitset.hpp>
+#include <util/FieldIndexer.hpp>
+
+namespace libclient::model {
+
+    /**
+     * layers of the bitboard representation, one bit per field (row major)
+     */
+    enum class BitboardLayer {
+        WALL,
+        FREE,
+        BAR_TABLE,
+        BAR_SEAT,
+        SAFE,
+        ROULETTE_TABLE,
+        FIREPLACE,
+        FOG,
+        GADGET,
+        OCCUPIED
+    };
+
+    /**
+     * bitboard layers of the map of the current state, refreshed by every GameStatus message
+     * neighbourhood queries on sets of fields are word parallel shifts of the layers
+     */
+    class Bitboards {
+        public:
+            static constexpr std::size_t numberOfLayers = 10;
+
+            /**
+             * reads all layers from state (fields are read by reference)
+             * @param s current state
+             */
+            void update(const spy::gameplay::State &s);
+
+            [[nodiscard]] std::size_t getWidth() const;
+
+            [[nodiscard]] std::size_t getHeight() const;
+
+            [[nodiscard]] const util::Bitset &get(BitboardLayer layer) const;
+
+            /**
+             * @return true if field p is in layer, false if p is outside of map
+             */
+            [[nodiscard]] bool test(BitboardLayer layer, const spy::util::Point &p) const;
+
+            /**
+             * @return free fields and bar seats
+             */
+            [[nodiscard]] util::Bitset getWalkable() const;
+
+            /**
+             * @return empty set with one bit per field
+             */
+            [[nodiscard]] util::Bitset makeSet() const;
+
+            /**
+             * @param fields set of fields
+             * @return fields and all fields next to them (king neighbourhood)
+             */
+            [[nodiscard]] util::Bitset expand(const util::Bitset &fields) const;
+
+            /**
+             * @param p position
+             * @return fields next to p (without p)
+             */
+            [[nodiscard]] util::Bitset getNeighbours(const spy::util::Point &p) const;
+
+            [[nodiscard]] std::optional<std::size_t> getIndex(const spy::util::Point &p) const;
+
+            [[nodiscard]] spy::util::Point getPoint(std::size_t index) const;
+
+            [[nodiscard]] const util::FieldIndexer &getIndexer() const;
+
+            /**
+             * @param fields set of fields
+             * @return positions of all fields in set
+             */
+            [[nodiscard]] std::vector<spy::util::Point> toPoints(const util::Bitset &fields) const;
+
+            /**
+             * @return approximate heap memory of the layers in bytes
+             */
+            [[nodiscard]] std::size_t getSizeInBytes() const;
+
+        private:
+            util::FieldIndexer indexer;
+            std::array<util::Bitset, numberOfLayers> layers;
+            util::Bitset notFirstColumn; // fields with x > 0
+            util::Bitset notLastColumn; // fields with x < width - 1
+    };
+}
+
+#endif //LIBCLIENT_BITBOARDS_HPP
@@ -0,0 +1,82 @@
+/**
+ * @file   CharacterGrid.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the occupancy grid mapping fields to characters.
+ */
+
+#include "CharacterGrid.hpp"
+#include <cstdlib>
+
+namespace libclient::model {
+
+    void CharacterGrid::build(const spy::gameplay::State &s) {
+        indexer = util::FieldIndexer(s.getMap().getMap());
+        fields.assign(indexer.getNumberOfFields(), noCharacter);
+        ids.clear();
+        positions.clear();
+
+        for (const auto &c: s.getCharacters()) {
+            auto coordinates = c.getCoordinates();
+            auto field = coordinates.has_value() ? indexer.getIndex(coordinates.value()) : std::nullopt;
+            if (field.has_value()) {
+                fields[field.value()] = ids.size();
+            }
+            ids.push_back(c.getCharacterId());
+            positions.push_back(coordinates);
+        }
+        built = true;
+    }
+
+    bool CharacterGrid::isBuilt() const {
+        return built;
+    }
+
+    std::optional<std::size_t> CharacterGrid::getIndex(const spy::util::Point &p) const {
+        auto field = indexer.getIndex(p);
+        if (!field.has_value() || fields[field.value()] == noCharacter) {
+            return std::nullopt;
+        }
+        return fields[field.value()];
+    }
+
+    std::optional<spy::util::UUID> CharacterGrid::getCharacterAt(const spy::util::Point &p) const {
+        auto index = getIndex(p);
+        if (!index.has_value()) {
+            return std::nullopt;
+        }
+        return ids[index.value()];
+    }
+
+    std::vector<spy::util::UUID>
+    CharacterGrid::getCharactersInRange(const spy::util::Point &center, unsigned int distance) const {
+        std::vector<spy::util::UUID> result;
+        auto d = static_cast<long>(distance);
+        auto side = static_cast<std::size_t>(2 * d + 1);
+
+        if (side * side > ids.size()) {
+            // window larger than number of characters -> check characters directly
+            for (std::size_t i = 0; i < ids.size(); i++) {
+                if (!positions[i].has_value()) {
+                    continue;
+                }
+                const auto &p = positions[i].value();
+                if (std::abs(static_cast<long>(p.x) - center.x) <= d &&
+                    std::abs(static_cast<long>(p.y) - center.y) <= d) {
+                    result.push_back(ids[i]);
+                }
+            }
+            return result;
+        }
+
+        for (long y = center.y - d; y <= center.y + d; y++) {
+            for (long x = center.x - d; x <= center.x + d; x++) {
+                auto index = getIndex(spy::util::Point{static_cast<int>(x), static_cast<int>(y)});
+                if (index.has_value()) {
+                    result.push_back(ids[index.value()]);
+                }
+            }
+        }
+        return result;
+    }
+}
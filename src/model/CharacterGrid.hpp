@@ -0,0 +1,79 @@
+/**
+ * @file   CharacterGrid.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the occupancy grid mapping fields to characters.
+ */
+
+#ifndef LIBCLIENT_CHARACTERGRID_HPP
+#define LIBCLIENT_CHARACTERGRID_HPP
+
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <vector>
+#include <datatypes/gameplay/State.hpp>
+#include <util/FieldIndexer.hpp>
+
+namespace libclient::model {
+
+    /**
+     * occupancy grid of a state: field -> index of the character in the character set of the state
+     * replaces linear search by coordinates (spy::util::GameLogicUtils::findInCharacterSetByCoordinates),
+     * lookups are only valid for the state (or an unchanged copy of it) the grid was built from
+     */
+    class CharacterGrid {
+        public:
+            /**
+             * (re)builds grid from positions of all characters in state
+             * @param s state to be indexed
+             */
+            void build(const spy::gameplay::State &s);
+
+            [[nodiscard]] bool isBuilt() const;
+
+            /**
+             * @param p position
+             * @return index of character on field in character set, nullopt if field is empty or outside of map
+             */
+            [[nodiscard]] std::optional<std::size_t> getIndex(const spy::util::Point &p) const;
+
+            /**
+             * @param p position
+             * @return id of character on field, nullopt if field is empty or outside of map
+             */
+            [[nodiscard]] std::optional<spy::util::UUID> getCharacterAt(const spy::util::Point &p) const;
+
+            /**
+             * drop in replacement for spy::util::GameLogicUtils::findInCharacterSetByCoordinates
+             * @param characters character set of the state the grid was built from
+             * @param p position
+             * @return iterator to character on field, characters.end() if there is none
+             */
+            template<typename CharacterSet>
+            [[nodiscard]] auto find(const CharacterSet &characters, const spy::util::Point &p) const {
+                auto index = getIndex(p);
+                return index.has_value() ? std::next(characters.begin(), static_cast<std::ptrdiff_t>(index.value()))
+                                         : characters.end();
+            }
+
+            /**
+             * @param center center of the range
+             * @param distance maximal distance (number of king moves, like movement on the map)
+             * @return ids of characters within distance to center (including character on center)
+             */
+            [[nodiscard]] std::vector<spy::util::UUID>
+            getCharactersInRange(const spy::util::Point &center, unsigned int distance) const;
+
+        private:
+            static constexpr std::size_t noCharacter = std::numeric_limits<std::size_t>::max();
+
+            util::FieldIndexer indexer;
+            std::vector<std::size_t> fields; // row major, character index or noCharacter
+            std::vector<spy::util::UUID> ids; // id per character index
+            std::vector<std::optional<spy::util::Point>> positions; // position per character index
+            bool built = false;
+    };
+}
+
+#endif //LIBCLIENT_CHARACTERGRID_HPP
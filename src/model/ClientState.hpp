@@ -8,6 +8,7 @@
 #ifndef LIBCLIENT_CLIENTSTATE_HPP
 #define LIBCLIENT_CLIENTSTATE_HPP
 
+#include <chrono>
 #include <string>
 #include <network/RoleEnum.hpp>
 #include <network/ErrorTypeEnum.hpp>
@@ -27,6 +28,9 @@ namespace libclient::model {
             std::string playerOneName; //set by GameStarted message
             std::string playerTwoName; //set by GameStarted message
             spy::util::UUID activeCharacter; //set by RequestGameOperation message
+            std::optional<std::chrono::steady_clock::time_point> operationRequested; //set by RequestGameOperation message
+            std::optional<std::chrono::steady_clock::time_point> operationSent; //set by sendGameOperation method
+            double roundTripTime = 0; // seconds from sendGameOperation to GameStatus message (smoothed)
             std::optional<spy::util::UUID> leftUserId; //set by GameLeft message
             std::optional<spy::network::ErrorTypeEnum> errorReason; //set by Error message
             bool gamePaused = false; //set by GamePause message
@@ -0,0 +1,259 @@
+/**
+ * @file   DistanceCache.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the all pairs distance and next step cache of the level.
+ */
+
+#include "DistanceCache.hpp"
+#include <algorithm>
+#include <chrono>
+#include <util/MemoryUtils.hpp>
+
+namespace libclient::model {
+
+    void DistanceCache::build(const spy::scenario::Scenario &level, bool background) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (background) {
+            pending = std::async(std::launch::async, &DistanceCache::compute, level.getScenario());
+        } else {
+            pending = std::future<std::shared_ptr<const Table>>();
+            table = compute(level.getScenario());
+        }
+    }
+
+    bool DistanceCache::isReady() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return !pending.valid() || pending.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    unsigned int DistanceCache::update(const spy::gameplay::State &s) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (pending.valid()) {
+            table = pending.get();
+        }
+
+        const auto &rows = s.getMap().getMap();
+        std::vector<std::uint32_t> destroyed;
+        for (std::uint32_t n = 0; n < table->size(); n++) {
+            const auto &p = table->nodes[n];
+            if (table->walkable[n] || static_cast<std::size_t>(p.y) >= rows.size() ||
+                static_cast<std::size_t>(p.x) >= rows[static_cast<std::size_t>(p.y)].size()) {
+                continue;
+            }
+            if (isWalkable(rows[static_cast<std::size_t>(p.y)][static_cast<std::size_t>(p.x)].getFieldState())) {
+                destroyed.push_back(n);
+            }
+        }
+        if (destroyed.empty()) {
+            return 0;
+        }
+
+        // snapshots held by queries stay untouched
+        auto patched = std::make_shared<Table>(*table);
+        for (auto n: destroyed) {
+            patched->patch(n);
+        }
+        table = std::move(patched);
+        return static_cast<unsigned int>(destroyed.size());
+    }
+
+    std::optional<unsigned int> DistanceCache::getDistance(const spy::util::Point &from,
+                                                           const spy::util::Point &to) const {
+        auto snapshot = get();
+        const auto &t = *snapshot;
+        auto a = t.node(from);
+        auto b = t.node(to);
+        if (a == noNode || b == noNode || t.distances[a * t.size() + b] == unreachable) {
+            return std::nullopt;
+        }
+        return t.distances[a * t.size() + b];
+    }
+
+    std::optional<spy::util::Point> DistanceCache::getNextStep(const spy::util::Point &from,
+                                                               const spy::util::Point &to) const {
+        auto snapshot = get();
+        const auto &t = *snapshot;
+        auto a = t.node(from);
+        auto b = t.node(to);
+        if (a == noNode || b == noNode || t.nextSteps[b * t.size() + a] == noNode) {
+            return std::nullopt;
+        }
+        return t.nodes[t.nextSteps[b * t.size() + a]];
+    }
+
+    std::optional<unsigned int> DistanceCache::getDistanceToNeighbour(const spy::util::Point &from,
+                                                                      const spy::util::Point &target) const {
+        auto snapshot = get();
+        const auto &t = *snapshot;
+        auto a = t.node(from);
+        if (a == noNode) {
+            return std::nullopt;
+        }
+
+        std::uint16_t best = unreachable;
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                auto b = t.node(spy::util::Point{target.x + dx, target.y + dy});
+                if ((dx != 0 || dy != 0) && b != noNode) {
+                    best = std::min(best, t.distances[a * t.size() + b]);
+                }
+            }
+        }
+        if (best == unreachable) {
+            return std::nullopt;
+        }
+        return best;
+    }
+
+    bool DistanceCache::isWalkable(const spy::util::Point &p) const {
+        auto snapshot = get();
+        const auto &t = *snapshot;
+        return t.node(p) != noNode;
+    }
+
+    std::shared_ptr<const DistanceCache::Table>
+    DistanceCache::compute(std::vector<std::vector<spy::scenario::FieldStateEnum>> fields) {
+        auto table = std::make_shared<Table>();
+        auto &t = *table;
+        t.indexer = util::FieldIndexer(fields);
+        t.fieldToNode.assign(t.indexer.getNumberOfFields(), noNode);
+        for (auto y = 0U; y < fields.size(); y++) {
+            for (auto x = 0U; x < fields[y].size(); x++) {
+                auto state = fields[y][x];
+                if (isWalkable(state) || state == spy::scenario::FieldStateEnum::WALL) {
+                    t.fieldToNode[t.indexer.getIndex(x, y)] = static_cast<std::uint32_t>(t.nodes.size());
+                    t.nodes.push_back(spy::util::Point{static_cast<int>(x), static_cast<int>(y)});
+                    t.walkable.push_back(isWalkable(state));
+                }
+            }
+        }
+
+        t.distances.assign(t.size() * t.size(), unreachable);
+        t.nextSteps.assign(t.size() * t.size(), noNode);
+        for (std::uint32_t n = 0; n < t.size(); n++) {
+            if (t.walkable[n]) {
+                t.search(n);
+            }
+        }
+        return table;
+    }
+
+    bool DistanceCache::isWalkable(spy::scenario::FieldStateEnum state) {
+        return state == spy::scenario::FieldStateEnum::FREE || state == spy::scenario::FieldStateEnum::BAR_SEAT;
+    }
+
+    std::shared_ptr<const DistanceCache::Table> DistanceCache::get() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (pending.valid()) {
+            table = pending.get();
+        }
+        return table;
+    }
+
+    std::size_t DistanceCache::getSizeInBytes() const {
+        if (!isReady()) {
+            return 0;
+        }
+        auto snapshot = get();
+        const auto &t = *snapshot;
+        return util::capacityInBytes(t.fieldToNode) + util::capacityInBytes(t.nodes) +
+               util::capacityInBytes(t.walkable) + util::capacityInBytes(t.distances) +
+               util::capacityInBytes(t.nextSteps);
+    }
+
+    std::size_t DistanceCache::Table::size() const {
+        return nodes.size();
+    }
+
+    std::uint32_t DistanceCache::Table::node(const spy::util::Point &p) const {
+        auto field = indexer.getIndex(p);
+        if (!field.has_value()) {
+            return noNode;
+        }
+        auto n = fieldToNode[field.value()];
+        return n != noNode && walkable[n] ? n : noNode;
+    }
+
+    template<typename Function>
+    void DistanceCache::Table::forEachNeighbour(std::uint32_t n, Function &&function) const {
+        const auto &p = nodes[n];
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                auto neighbour = node(spy::util::Point{p.x + dx, p.y + dy});
+                if ((dx != 0 || dy != 0) && neighbour != noNode) {
+                    function(neighbour);
+                }
+            }
+        }
+    }
+
+    void DistanceCache::Table::search(std::uint32_t root) {
+        auto n = size();
+        auto *dist = &distances[root * n];
+        auto *next = &nextSteps[root * n];
+        std::fill(dist, dist + n, unreachable);
+        std::fill(next, next + n, noNode);
+
+        std::vector<std::uint32_t> queue;
+        queue.reserve(n);
+        queue.push_back(root);
+        dist[root] = 0;
+        for (std::size_t head = 0; head < queue.size(); head++) {
+            auto current = queue[head];
+            forEachNeighbour(current, [&](std::uint32_t neighbour) {
+                if (dist[neighbour] == unreachable) {
+                    dist[neighbour] = static_cast<std::uint16_t>(dist[current] + 1);
+                    // path from neighbour to root continues with current
+                    next[neighbour] = current;
+                    queue.push_back(neighbour);
+                }
+            });
+        }
+    }
+
+    void DistanceCache::Table::patch(std::uint32_t w) {
+        auto n = size();
+        walkable[w] = true;
+
+        // first step from w towards every node (shortest paths leaving w do not return to w)
+        std::vector<std::uint32_t> stepFromW(n, noNode);
+        for (std::uint32_t r = 0; r < n; r++) {
+            if (r == w || !walkable[r]) {
+                continue;
+            }
+            std::uint16_t best = unreachable;
+            forEachNeighbour(w, [&](std::uint32_t u) {
+                if (u != w && distances[r * n + u] < best) {
+                    best = distances[r * n + u];
+                    stepFromW[r] = u;
+                }
+            });
+        }
+
+        // distances from w and next steps towards w
+        search(w);
+        for (std::uint32_t v = 0; v < n; v++) {
+            distances[v * n + w] = distances[w * n + v];
+        }
+
+        // shorten paths going through w
+        for (std::uint32_t r = 0; r < n; r++) {
+            auto toW = distances[r * n + w];
+            if (r == w || !walkable[r] || toW == unreachable) {
+                continue;
+            }
+            for (std::uint32_t v = 0; v < n; v++) {
+                auto fromW = distances[w * n + v];
+                if (v == w || v == r || fromW == unreachable) {
+                    continue;
+                }
+                if (static_cast<unsigned int>(toW) + fromW < distances[r * n + v]) {
+                    distances[r * n + v] = static_cast<std::uint16_t>(toW + fromW);
+                    nextSteps[r * n + v] = nextSteps[w * n + v];
+                }
+            }
+            nextSteps[r * n + w] = stepFromW[r];
+        }
+    }
+}
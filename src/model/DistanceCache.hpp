@@ -0,0 +1,136 @@
+/**
+ * @file   DistanceCache.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the all pairs distance and next step cache of the level.
+ */
+
+#ifndef LIBCLIENT_DISTANCECACHE_HPP
+#define LIBCLIENT_DISTANCECACHE_HPP
+
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <vector>
+#include <datatypes/gameplay/State.hpp>
+#include <datatypes/scenario/Scenario.hpp>
+#include <util/FieldIndexer.hpp>
+
+namespace libclient::model {
+
+    /**
+     * movement distances between all walkable fields (free fields and bar seats) of the level, one step per
+     * king move, and first step of a shortest path for every pair
+     * characters do not block paths (moving onto an occupied field swaps places) and fog does not affect movement,
+     * so only walls destroyed during the game change the cache, they are patched in O(n^2) per field
+     * table is computed once (O(n^2) memory and time for n walkable fields plus walls), optionally on a
+     * background thread, queries block until it is available
+     * queries work on an immutable snapshot of the table, update replaces the snapshot instead of patching it in
+     * place (copy on write), so queries from other threads never see a half patched or destroyed table
+     * @note not copyable (holds a mutex and the future of the background computation), neither is GameState
+     */
+    class DistanceCache {
+        public:
+            /**
+             * computes distances for the level layout
+             * @param level scenario from HelloReply message
+             * @param background true to compute on a background thread (see isReady)
+             */
+            void build(const spy::scenario::Scenario &level, bool background = false);
+
+            /**
+             * @return true if table is computed (queries do not block)
+             */
+            [[nodiscard]] bool isReady() const;
+
+            /**
+             * patches cache for walls destroyed since the last build / update
+             * @param s current state
+             * @return number of fields that became walkable
+             */
+            unsigned int update(const spy::gameplay::State &s);
+
+            /**
+             * @param from start field
+             * @param to target field
+             * @return minimal number of steps, nullopt if a field is not walkable or target is unreachable
+             */
+            [[nodiscard]] std::optional<unsigned int> getDistance(const spy::util::Point &from,
+                                                                  const spy::util::Point &to) const;
+
+            /**
+             * @param from start field
+             * @param to target field
+             * @return first field of a shortest path (to itself if it is next to from), nullopt if unreachable or
+             * from equals to
+             */
+            [[nodiscard]] std::optional<spy::util::Point> getNextStep(const spy::util::Point &from,
+                                                                      const spy::util::Point &to) const;
+
+            /**
+             * distance to a field that can not be entered (safe, bar table, roulette table, character)
+             * @param from start field
+             * @param target target field
+             * @return minimal number of steps to a walkable field next to target, nullopt if there is none
+             */
+            [[nodiscard]] std::optional<unsigned int> getDistanceToNeighbour(const spy::util::Point &from,
+                                                                             const spy::util::Point &target) const;
+
+            [[nodiscard]] bool isWalkable(const spy::util::Point &p) const;
+
+            /**
+             * @return approximate heap memory of the table in bytes, 0 while it is computed in the background
+             */
+            [[nodiscard]] std::size_t getSizeInBytes() const;
+
+        private:
+            static constexpr std::uint32_t noNode = std::numeric_limits<std::uint32_t>::max();
+            static constexpr std::uint16_t unreachable = std::numeric_limits<std::uint16_t>::max();
+
+            struct Table {
+                util::FieldIndexer indexer;
+                std::vector<std::uint32_t> fieldToNode; // row major, noNode for fields that never get walkable
+                std::vector<spy::util::Point> nodes; // walkable fields and walls
+                std::vector<bool> walkable; // per node
+                std::vector<std::uint16_t> distances; // [a * n + b], symmetric
+                std::vector<std::uint32_t> nextSteps; // [to * n + from], next node on path from -> to
+
+                [[nodiscard]] std::size_t size() const;
+
+                [[nodiscard]] std::uint32_t node(const spy::util::Point &p) const;
+
+                template<typename Function>
+                void forEachNeighbour(std::uint32_t n, Function &&function) const;
+
+                /**
+                 * breadth first search from root, fills distances from root and next steps towards root
+                 */
+                void search(std::uint32_t root);
+
+                /**
+                 * makes node walkable and shortens all paths that can go through it
+                 */
+                void patch(std::uint32_t w);
+            };
+
+            [[nodiscard]] static std::shared_ptr<const Table>
+            compute(std::vector<std::vector<spy::scenario::FieldStateEnum>> fields);
+
+            [[nodiscard]] static bool isWalkable(spy::scenario::FieldStateEnum state);
+
+            /**
+             * @return snapshot of computed table (stays valid while held), waits for background computation if
+             * necessary
+             */
+            [[nodiscard]] std::shared_ptr<const Table> get() const;
+
+            mutable std::mutex mutex;
+            mutable std::future<std::shared_ptr<const Table>> pending;
+            mutable std::shared_ptr<const Table> table = std::make_shared<const Table>();
+    };
+}
+
+#endif //LIBCLIENT_DISTANCECACHE_HPP
@@ -0,0 +1,208 @@
+/**
+ * @file   FactionSolver.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the constraint propagation solver for hidden faction assignments.
+ */
+
+#include "FactionSolver.hpp"
+#include <algorithm>
+
+namespace libclient::model {
+
+    std::optional<double>
+    FactionSolution::getProbability(const spy::util::UUID &id, spy::character::FactionEnum faction) const {
+        if (!consistent) {
+            return std::nullopt;
+        }
+        auto it = std::find(characters.begin(), characters.end(), id);
+        if (it == characters.end()) {
+            return std::nullopt;
+        }
+        const auto &m = marginals.at(static_cast<std::size_t>(std::distance(characters.begin(), it)));
+        switch (faction) {
+            case spy::character::FactionEnum::PLAYER1:
+                return m[0];
+            case spy::character::FactionEnum::PLAYER2:
+                return m[1];
+            case spy::character::FactionEnum::NEUTRAL:
+                return m[2];
+            default:
+                return std::nullopt;
+        }
+    }
+
+    FactionSolver::FactionSolver(FactionCounts c) : counts(c) {}
+
+    void FactionSolver::addCharacter(const spy::util::UUID &id, std::array<double, 3> w) {
+        weights.at(getOrAdd(id)) = w;
+    }
+
+    bool FactionSolver::setFaction(const spy::util::UUID &id, spy::character::FactionEnum faction) {
+        auto index = factionIndex(faction);
+        if (!index.has_value()) {
+            return false;
+        }
+        auto &w = weights.at(getOrAdd(id));
+        for (std::size_t f = 0; f < w.size(); f++) {
+            if (f != index.value()) {
+                w[f] = 0;
+            }
+        }
+        return true;
+    }
+
+    bool FactionSolver::excludeFaction(const spy::util::UUID &id, spy::character::FactionEnum faction) {
+        auto index = factionIndex(faction);
+        if (!index.has_value()) {
+            return false;
+        }
+        weights.at(getOrAdd(id))[index.value()] = 0;
+        return true;
+    }
+
+    FactionSolution FactionSolver::solve() const {
+        FactionSolution solution;
+        solution.characters = characters;
+
+        const auto n = characters.size();
+        auto backward = backwardTable();
+        const double total = backward.at(tableIndex(0, 0, 0));
+        if (total <= 0) {
+            return solution;
+        }
+        solution.consistent = true;
+        solution.total = total;
+
+        // forward pass: weighted number of prefixes reaching (i, my, enemy)
+        std::vector<double> forward((n + 1) * (n + 1) * (n + 1), 0.0);
+        forward[tableIndex(0, 0, 0)] = 1;
+        solution.marginals.assign(n, {0, 0, 0});
+        for (std::size_t i = 0; i < n; i++) {
+            for (std::size_t my = 0; my <= i; my++) {
+                for (std::size_t enemy = 0; my + enemy <= i; enemy++) {
+                    double f = forward[tableIndex(i, my, enemy)];
+                    if (f <= 0) {
+                        continue;
+                    }
+                    const auto &w = weights[i];
+                    double toMy = f * w[0];
+                    double toEnemy = f * w[1];
+                    double toNpc = f * w[2];
+                    forward[tableIndex(i + 1, my + 1, enemy)] += toMy;
+                    forward[tableIndex(i + 1, my, enemy + 1)] += toEnemy;
+                    forward[tableIndex(i + 1, my, enemy)] += toNpc;
+                    solution.marginals[i][0] += toMy * backward[tableIndex(i + 1, my + 1, enemy)];
+                    solution.marginals[i][1] += toEnemy * backward[tableIndex(i + 1, my, enemy + 1)];
+                    solution.marginals[i][2] += toNpc * backward[tableIndex(i + 1, my, enemy)];
+                }
+            }
+
+            for (std::size_t f = 0; f < 3; f++) {
+                solution.marginals[i][f] /= total;
+                if (solution.marginals[i][f] >= 1 - 1e-12) {
+                    solution.marginals[i] = {0, 0, 0};
+                    solution.marginals[i][f] = 1;
+                    solution.forced.emplace_back(characters[i], indexToFaction(f));
+                }
+            }
+        }
+
+        return solution;
+    }
+
+    double FactionSolver::getWeight(const std::vector<spy::character::FactionEnum> &assignment) const {
+        if (assignment.size() != characters.size()) {
+            return 0;
+        }
+        double weight = 1;
+        std::array<std::size_t, 3> sizes = {0, 0, 0};
+        for (std::size_t i = 0; i < assignment.size(); i++) {
+            auto index = factionIndex(assignment[i]);
+            if (!index.has_value()) {
+                return 0;
+            }
+            weight *= weights[i][index.value()];
+            sizes[index.value()]++;
+        }
+        return isValidTotal(sizes[0], sizes[1], sizes[2]) ? weight : 0;
+    }
+
+    std::vector<double> FactionSolver::getSamplingTable() const {
+        return backwardTable();
+    }
+
+    const std::vector<spy::util::UUID> &FactionSolver::getCharacters() const {
+        return characters;
+    }
+
+    std::optional<std::size_t> FactionSolver::factionIndex(spy::character::FactionEnum faction) {
+        switch (faction) {
+            case spy::character::FactionEnum::PLAYER1:
+                return 0;
+            case spy::character::FactionEnum::PLAYER2:
+                return 1;
+            case spy::character::FactionEnum::NEUTRAL:
+                return 2;
+            default:
+                return std::nullopt;
+        }
+    }
+
+    spy::character::FactionEnum FactionSolver::indexToFaction(std::size_t index) {
+        switch (index) {
+            case 0:
+                return spy::character::FactionEnum::PLAYER1;
+            case 1:
+                return spy::character::FactionEnum::PLAYER2;
+            default:
+                return spy::character::FactionEnum::NEUTRAL;
+        }
+    }
+
+    std::size_t FactionSolver::getOrAdd(const spy::util::UUID &id) {
+        auto it = std::find(characters.begin(), characters.end(), id);
+        if (it != characters.end()) {
+            return static_cast<std::size_t>(std::distance(characters.begin(), it));
+        }
+        characters.push_back(id);
+        weights.push_back({1, 1, 1});
+        return characters.size() - 1;
+    }
+
+    bool FactionSolver::isValidTotal(std::size_t my, std::size_t enemy, std::size_t npc) const {
+        auto inBounds = [](std::size_t value, const FactionCount &c) {
+            return value >= c.min && value <= c.max;
+        };
+        return inBounds(my, counts.my) && inBounds(enemy, counts.enemy) && inBounds(npc, counts.npc);
+    }
+
+    std::vector<double> FactionSolver::backwardTable() const {
+        const auto n = characters.size();
+        std::vector<double> backward((n + 1) * (n + 1) * (n + 1), 0.0);
+
+        for (std::size_t my = 0; my <= n; my++) {
+            for (std::size_t enemy = 0; my + enemy <= n; enemy++) {
+                backward[tableIndex(n, my, enemy)] = isValidTotal(my, enemy, n - my - enemy) ? 1 : 0;
+            }
+        }
+
+        for (std::size_t i = n; i-- > 0;) {
+            const auto &w = weights[i];
+            for (std::size_t my = 0; my <= i; my++) {
+                for (std::size_t enemy = 0; my + enemy <= i; enemy++) {
+                    backward[tableIndex(i, my, enemy)] = w[0] * backward[tableIndex(i + 1, my + 1, enemy)]
+                                                         + w[1] * backward[tableIndex(i + 1, my, enemy + 1)]
+                                                         + w[2] * backward[tableIndex(i + 1, my, enemy)];
+                }
+            }
+        }
+
+        return backward;
+    }
+
+    std::size_t FactionSolver::tableIndex(std::size_t i, std::size_t my, std::size_t enemy) const {
+        const auto size = characters.size() + 1;
+        return (i * size + my) * size + enemy;
+    }
+}
@@ -0,0 +1,194 @@
+/**
+ * @file   FactionSolver.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the constraint propagation solver for hidden faction assignments.
+ */
+
+#ifndef LIBCLIENT_FACTIONSOLVER_HPP
+#define LIBCLIENT_FACTIONSOLVER_HPP
+
+#include <array>
+#include <limits>
+#include <optional>
+#include <vector>
+#include <util/UUID.hpp>
+#include <datatypes/character/FactionEnum.hpp>
+
+namespace libclient::model {
+
+    /**
+     * bounds for the number of characters of a faction
+     */
+    struct FactionCount {
+        unsigned int min = 0;
+        unsigned int max = std::numeric_limits<unsigned int>::max();
+    };
+
+    /**
+     * known faction sizes, factions are relative to the client like in AIState (my, enemy, npc)
+     */
+    struct FactionCounts {
+        FactionCount my;
+        FactionCount enemy;
+        FactionCount npc;
+    };
+
+    /**
+     * result of FactionSolver::solve
+     */
+    struct FactionSolution {
+        bool consistent = false; // false if no assignment satisfies all constraints
+        double total = 0; // weighted number of assignments satisfying all constraints
+        std::vector<spy::util::UUID> characters;
+        // probability per character in order PLAYER1 (my), PLAYER2 (enemy), NEUTRAL (npc)
+        std::vector<std::array<double, 3>> marginals;
+        // characters whose faction is determined by the constraints (PLAYER1 if my, PLAYER2 if enemy, NEUTRAL if npc)
+        std::vector<std::pair<spy::util::UUID, spy::character::FactionEnum>> forced;
+
+        /**
+         * @return nullopt if character is unknown or solution is inconsistent, else probability
+         */
+        [[nodiscard]] std::optional<double>
+        getProbability(const spy::util::UUID &id, spy::character::FactionEnum faction) const;
+    };
+
+    /**
+     * counts all faction assignments that are consistent with hard facts, exclusions and faction sizes
+     * uses dynamic programming over (characters, #my, #enemy) -> O(n^3) instead of enumerating 3^n assignments
+     * factions are relative to the client: PLAYER1 is my faction, PLAYER2 the enemy, NEUTRAL npcs
+     */
+    class FactionSolver {
+        public:
+            /**
+             * @param counts bounds for the faction sizes
+             */
+            explicit FactionSolver(FactionCounts counts = {});
+
+            /**
+             * adds character that can have any faction that is not excluded
+             * @param id id of the character
+             * @param weights optional prior weight per faction (order PLAYER1, PLAYER2, NEUTRAL), default uniform
+             */
+            void addCharacter(const spy::util::UUID &id, std::array<double, 3> weights = {1, 1, 1});
+
+            /**
+             * fixes faction of character (adds character if not yet added)
+             * @param id id of the character
+             * @param faction PLAYER1, PLAYER2 or NEUTRAL
+             * @return false if faction is invalid
+             */
+            bool setFaction(const spy::util::UUID &id, spy::character::FactionEnum faction);
+
+            /**
+             * excludes faction for character (adds character if not yet added)
+             * @param id id of the character
+             * @param faction PLAYER1, PLAYER2 or NEUTRAL
+             * @return false if faction is invalid
+             */
+            bool excludeFaction(const spy::util::UUID &id, spy::character::FactionEnum faction);
+
+            /**
+             * computes exact marginals and forced assignments
+             * @return solution, consistent is false if constraints contradict each other
+             */
+            [[nodiscard]] FactionSolution solve() const;
+
+            /**
+             * draws one assignment with probability proportional to its weight
+             * @param random uniformly distributed numbers in [0, 1), one is consumed per character
+             * @return faction per character in order of addCharacter, nullopt if constraints are inconsistent
+             */
+            template<typename Random>
+            [[nodiscard]] std::optional<std::vector<spy::character::FactionEnum>> sample(Random &&random) const;
+
+            /**
+             * same as sample(random) but reuses table from getSamplingTable() (for drawing many samples)
+             * @param random uniformly distributed numbers in [0, 1), one is consumed per character
+             * @param table result of getSamplingTable()
+             * @param result faction per character in order of addCharacter, untouched if inconsistent
+             * @return false if constraints are inconsistent
+             */
+            template<typename Random>
+            bool sample(Random &&random, const std::vector<double> &table,
+                        std::vector<spy::character::FactionEnum> &result) const;
+
+            /**
+             * @param assignment faction per character in order of addCharacter
+             * @return weight of assignment (product of the weights of its factions), 0 if it violates a constraint
+             * @note probability of assignment is getWeight(assignment) / solve().total
+             */
+            [[nodiscard]] double getWeight(const std::vector<spy::character::FactionEnum> &assignment) const;
+
+            /**
+             * @return precomputed counting table for sample
+             */
+            [[nodiscard]] std::vector<double> getSamplingTable() const;
+
+            [[nodiscard]] const std::vector<spy::util::UUID> &getCharacters() const;
+
+        private:
+            FactionCounts counts;
+            std::vector<spy::util::UUID> characters;
+            std::vector<std::array<double, 3>> weights;
+
+            [[nodiscard]] static std::optional<std::size_t> factionIndex(spy::character::FactionEnum faction);
+
+            [[nodiscard]] static spy::character::FactionEnum indexToFaction(std::size_t index);
+
+            std::size_t getOrAdd(const spy::util::UUID &id);
+
+            [[nodiscard]] bool isValidTotal(std::size_t my, std::size_t enemy, std::size_t npc) const;
+
+            /**
+             * backward table: entry (i, my, enemy) is the weighted number of completions of characters i..n-1
+             * given that my and enemy characters were assigned before i
+             */
+            [[nodiscard]] std::vector<double> backwardTable() const;
+
+            [[nodiscard]] std::size_t tableIndex(std::size_t i, std::size_t my, std::size_t enemy) const;
+    };
+
+    template<typename Random>
+    std::optional<std::vector<spy::character::FactionEnum>> FactionSolver::sample(Random &&random) const {
+        std::vector<spy::character::FactionEnum> result;
+        if (!sample(std::forward<Random>(random), backwardTable(), result)) {
+            return std::nullopt;
+        }
+        return result;
+    }
+
+    template<typename Random>
+    bool FactionSolver::sample(Random &&random, const std::vector<double> &backward,
+                               std::vector<spy::character::FactionEnum> &result) const {
+        if (backward.at(tableIndex(0, 0, 0)) <= 0) {
+            return false;
+        }
+
+        result.resize(characters.size());
+        std::size_t my = 0;
+        std::size_t enemy = 0;
+        for (std::size_t i = 0; i < characters.size(); i++) {
+            std::array<double, 3> mass = {
+                    weights[i][0] * backward[tableIndex(i + 1, my + 1, enemy)],
+                    weights[i][1] * backward[tableIndex(i + 1, my, enemy + 1)],
+                    weights[i][2] * backward[tableIndex(i + 1, my, enemy)]};
+            double r = random() * (mass[0] + mass[1] + mass[2]);
+            std::size_t choice = 0;
+            while (choice < 2 && (r >= mass[choice] || mass[choice] <= 0)) {
+                r -= mass[choice];
+                choice++;
+            }
+            while (mass[choice] <= 0 && choice > 0) {
+                // rounding error pushed r behind last possible faction
+                choice--;
+            }
+            my += choice == 0;
+            enemy += choice == 1;
+            result[i] = indexToFaction(choice);
+        }
+        return true;
+    }
+}
+
+#endif //LIBCLIENT_FACTIONSOLVER_HPP
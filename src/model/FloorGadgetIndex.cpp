@@ -0,0 +1,97 @@
+/**
+ * @file   FloorGadgetIndex.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the index of gadgets lying on the playing field.
+ */
+
+#include "FloorGadgetIndex.hpp"
+#include <limits>
+#include <util/MemoryUtils.hpp>
+
+namespace libclient::model {
+
+    void FloorGadgetIndex::build(const spy::gameplay::State &s) {
+        using spy::scenario::FieldStateEnum;
+
+        candidates.clear();
+        const auto &rows = s.getMap().getMap();
+        indexer = util::FieldIndexer(rows);
+        fieldToCandidate.assign(indexer.getNumberOfFields(), std::numeric_limits<std::size_t>::max());
+        for (auto y = 0U; y < rows.size(); y++) {
+            for (auto x = 0U; x < rows[y].size(); x++) {
+                auto state = rows[y][x].getFieldState();
+                if (state == FieldStateEnum::FREE || state == FieldStateEnum::BAR_SEAT ||
+                    state == FieldStateEnum::BAR_TABLE) {
+                    fieldToCandidate[indexer.getIndex(x, y)] = candidates.size();
+                    candidates.push_back(spy::util::Point{static_cast<int>(x), static_cast<int>(y)});
+                }
+            }
+        }
+        gadgets.assign(candidates.size(), spy::gadget::GadgetEnum::INVALID);
+        counts.fill(0);
+        built = true;
+    }
+
+    bool FloorGadgetIndex::isBuilt() const {
+        return built;
+    }
+
+    void FloorGadgetIndex::update(const spy::gameplay::State &s, bool fieldStatesChanged) {
+        if (!built || fieldStatesChanged) {
+            build(s);
+        }
+
+        const auto &rows = s.getMap().getMap();
+
+        for (std::size_t i = 0; i < candidates.size(); i++) {
+            const auto &p = candidates[i];
+            const auto &gad = rows[static_cast<std::size_t>(p.y)][static_cast<std::size_t>(p.x)].getGadget();
+            auto type = gad.has_value() ? gad.value()->getType() : spy::gadget::GadgetEnum::INVALID;
+            if (type == gadgets[i]) {
+                continue;
+            }
+
+            counts[static_cast<std::size_t>(gadgets[i])] -= gadgets[i] != spy::gadget::GadgetEnum::INVALID;
+            counts[static_cast<std::size_t>(type)] += type != spy::gadget::GadgetEnum::INVALID;
+            gadgets[i] = type;
+        }
+    }
+
+    unsigned int FloorGadgetIndex::count(spy::gadget::GadgetEnum type) const {
+        return counts.at(static_cast<std::size_t>(type));
+    }
+
+    std::vector<spy::gadget::GadgetEnum> FloorGadgetIndex::getGadgetTypes() const {
+        std::vector<spy::gadget::GadgetEnum> types;
+        for (std::size_t type = 1; type < counts.size(); type++) {
+            if (counts[type] > 0) {
+                types.push_back(spy::gadget::GadgetEnum(type));
+            }
+        }
+        return types;
+    }
+
+    spy::gadget::GadgetEnum FloorGadgetIndex::getGadgetAt(const spy::util::Point &p) const {
+        auto field = indexer.getIndex(p);
+        if (!field.has_value() || fieldToCandidate[field.value()] >= candidates.size()) {
+            return spy::gadget::GadgetEnum::INVALID;
+        }
+        return gadgets[fieldToCandidate[field.value()]];
+    }
+
+    std::vector<spy::util::Point> FloorGadgetIndex::getGadgetFields() const {
+        std::vector<spy::util::Point> fields;
+        for (std::size_t i = 0; i < candidates.size(); i++) {
+            if (gadgets[i] != spy::gadget::GadgetEnum::INVALID) {
+                fields.push_back(candidates[i]);
+            }
+        }
+        return fields;
+    }
+
+    std::size_t FloorGadgetIndex::getSizeInBytes() const {
+        return util::capacityInBytes(candidates) + util::capacityInBytes(fieldToCandidate) +
+               util::capacityInBytes(gadgets);
+    }
+}
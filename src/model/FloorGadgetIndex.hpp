@@ -0,0 +1,80 @@
+/**
+ * @file   FloorGadgetIndex.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the index of gadgets lying on the playing field.
+ */
+
+#ifndef LIBCLIENT_FLOORGADGETINDEX_HPP
+#define LIBCLIENT_FLOORGADGETINDEX_HPP
+
+#include <array>
+#include <vector>
+#include <datatypes/gameplay/State.hpp>
+#include <util/FieldIndexer.hpp>
+#include <util/GadgetTypes.hpp>
+
+namespace libclient::model {
+
+    /**
+     * keeps track of the gadgets lying on fields that can hold gadgets (free fields, bar seats and bar tables)
+     * the candidate fields are collected by build and again whenever field states changed (e.g. destroyed walls),
+     * updates only read these fields by reference (no map or field copies)
+     */
+    class FloorGadgetIndex {
+        public:
+            /**
+             * collects fields that can hold gadgets from the field states of the state
+             * @param s current state
+             */
+            void build(const spy::gameplay::State &s);
+
+            [[nodiscard]] bool isBuilt() const;
+
+            /**
+             * reads gadgets of the candidate fields from state, builds the index first if it is not built yet or
+             * field states changed
+             * @param s current state
+             * @param fieldStatesChanged true if field states changed since the last call (e.g. DistanceCache::update
+             *                           found destroyed walls)
+             */
+            void update(const spy::gameplay::State &s, bool fieldStatesChanged = false);
+
+            /**
+             * @param type gadget type
+             * @return number of gadgets of type on the floor
+             */
+            [[nodiscard]] unsigned int count(spy::gadget::GadgetEnum type) const;
+
+            /**
+             * @return all gadget types lying on the floor (each type once)
+             */
+            [[nodiscard]] std::vector<spy::gadget::GadgetEnum> getGadgetTypes() const;
+
+            /**
+             * @param p position
+             * @return gadget type on the field, INVALID if there is none or field can not hold gadgets
+             */
+            [[nodiscard]] spy::gadget::GadgetEnum getGadgetAt(const spy::util::Point &p) const;
+
+            /**
+             * @return positions of all fields holding a gadget
+             */
+            [[nodiscard]] std::vector<spy::util::Point> getGadgetFields() const;
+
+            /**
+             * @return approximate heap memory of the index in bytes
+             */
+            [[nodiscard]] std::size_t getSizeInBytes() const;
+
+        private:
+            std::vector<spy::util::Point> candidates;
+            std::vector<std::size_t> fieldToCandidate; // row major, SIZE_MAX for fields that can not hold gadgets
+            util::FieldIndexer indexer;
+            std::vector<spy::gadget::GadgetEnum> gadgets; // gadget per candidate field
+            std::array<unsigned int, util::numberOfGadgetTypes> counts{};
+            bool built = false;
+    };
+}
+
+#endif //LIBCLIENT_FLOORGADGETINDEX_HPP
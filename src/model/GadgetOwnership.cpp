@@ -0,0 +1,161 @@
+/**
+ * @file   GadgetOwnership.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the gadget ownership matrix.
+ */
+
+#include "GadgetOwnership.hpp"
+#include <algorithm>
+#include <numeric>
+
+namespace libclient::model {
+
+    GadgetOwnership::GadgetOwnership(std::vector<spy::util::UUID> chars) : characters(std::move(chars)),
+                                                                            columns(characters.size() + 2),
+                                                                            probabilities(
+                                                                                    numberOfGadgetTypes * columns,
+                                                                                    0.0) {}
+
+    std::size_t GadgetOwnership::getNumberOfColumns() const {
+        return columns;
+    }
+
+    std::size_t GadgetOwnership::getFloorColumn() const {
+        return columns - 2;
+    }
+
+    std::size_t GadgetOwnership::getUnassignedColumn() const {
+        return columns - 1;
+    }
+
+    const std::vector<spy::util::UUID> &GadgetOwnership::getCharacters() const {
+        return characters;
+    }
+
+    std::optional<std::size_t> GadgetOwnership::getColumn(const spy::util::UUID &id) const {
+        auto it = std::find(characters.begin(), characters.end(), id);
+        if (it == characters.end()) {
+            return std::nullopt;
+        }
+        return static_cast<std::size_t>(std::distance(characters.begin(), it));
+    }
+
+    const double *GadgetOwnership::getRow(spy::gadget::GadgetEnum type) const {
+        auto row = rowIndex(type);
+        return row.has_value() ? probabilities.data() + row.value() * columns : nullptr;
+    }
+
+    bool GadgetOwnership::hasInformation(spy::gadget::GadgetEnum type) const {
+        auto row = rowIndex(type);
+        return row.has_value() && information[row.value()];
+    }
+
+    std::optional<double>
+    GadgetOwnership::getProbability(const spy::util::UUID &id, spy::gadget::GadgetEnum type) const {
+        auto column = getColumn(id);
+        if (!column.has_value() || !hasInformation(type)) {
+            return std::nullopt;
+        }
+        return getRow(type)[column.value()];
+    }
+
+    std::optional<double> GadgetOwnership::getFloorProbability(spy::gadget::GadgetEnum type) const {
+        if (!hasInformation(type)) {
+            return std::nullopt;
+        }
+        return getRow(type)[getFloorColumn()];
+    }
+
+    bool GadgetOwnership::setCertain(spy::gadget::GadgetEnum type, std::size_t column) {
+        auto row = rowIndex(type);
+        if (!row.has_value() || column >= columns) {
+            return false;
+        }
+        auto begin = probabilities.begin() + row.value() * columns;
+        std::fill(begin, begin + columns, 0.0);
+        begin[column] = 1.0;
+        information[row.value()] = true;
+        return true;
+    }
+
+    bool GadgetOwnership::setRow(spy::gadget::GadgetEnum type, const std::vector<double> &weights) {
+        auto row = rowIndex(type);
+        if (!row.has_value() || weights.size() != columns) {
+            return false;
+        }
+        double *p = probabilities.data() + row.value() * columns;
+        std::copy_n(weights.begin(), columns, p);
+        double sum = std::accumulate(p, p + columns, 0.0);
+        if (sum <= 0 || sum > 1) {
+            normalizeRow(row.value());
+            return true;
+        }
+        // weights are probabilities of their own, a single uncertain candidate must not become certain
+        p[getUnassignedColumn()] += 1 - sum;
+        information[row.value()] = true;
+        return true;
+    }
+
+    bool GadgetOwnership::updateRow(spy::gadget::GadgetEnum type, const std::vector<double> &likelihoods) {
+        auto row = rowIndex(type);
+        if (!row.has_value() || likelihoods.size() != columns) {
+            return false;
+        }
+        double *p = probabilities.data() + row.value() * columns;
+        const double *l = likelihoods.data();
+        // plain index loop over contiguous memory, gets vectorized by the compiler
+        for (std::size_t i = 0; i < columns; i++) {
+            p[i] *= l[i];
+        }
+        normalizeRow(row.value());
+        return true;
+    }
+
+    bool GadgetOwnership::clearRow(spy::gadget::GadgetEnum type) {
+        auto row = rowIndex(type);
+        if (!row.has_value()) {
+            return false;
+        }
+        auto begin = probabilities.begin() + row.value() * columns;
+        std::fill(begin, begin + columns, 0.0);
+        information[row.value()] = false;
+        return true;
+    }
+
+    void GadgetOwnership::normalize() {
+        for (std::size_t row = 0; row < numberOfGadgetTypes; row++) {
+            if (information[row]) {
+                normalizeRow(row);
+            }
+        }
+    }
+
+    std::optional<std::size_t> GadgetOwnership::rowIndex(spy::gadget::GadgetEnum type) {
+        if (!util::isGadgetType(type)) {
+            return std::nullopt;
+        }
+        return static_cast<std::size_t>(type) - 1;
+    }
+
+    void GadgetOwnership::normalizeRow(std::size_t row) {
+        double *p = probabilities.data() + row * columns;
+        double sum = 0;
+        for (std::size_t i = 0; i < columns; i++) {
+            sum += p[i];
+        }
+
+        if (sum <= 0) {
+            // no probability mass left -> nothing known about location
+            std::fill(p, p + columns, 0.0);
+            information.at(row) = false;
+            return;
+        }
+
+        double factor = 1 / sum;
+        for (std::size_t i = 0; i < columns; i++) {
+            p[i] *= factor;
+        }
+        information.at(row) = true;
+    }
+}
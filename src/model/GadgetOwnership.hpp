@@ -0,0 +1,135 @@
+/**
+ * @file   GadgetOwnership.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the gadget ownership matrix (gadget types x (characters + floor)).
+ */
+
+#ifndef LIBCLIENT_GADGETOWNERSHIP_HPP
+#define LIBCLIENT_GADGETOWNERSHIP_HPP
+
+#include <optional>
+#include <vector>
+#include <util/UUID.hpp>
+#include <datatypes/gadgets/GadgetEnum.hpp>
+#include <util/GadgetTypes.hpp>
+
+namespace libclient::model {
+
+    /**
+     * dense probability matrix with one row per gadget type and one column per character plus one for the floor and
+     * one for the mass not assigned to any of them (e.g. certainty of the candidates does not add up to 1)
+     * entry (g, c) is the probability that gadget g is owned by column c, rows with information sum up to 1
+     */
+    class GadgetOwnership {
+        public:
+            // one row per gadget type, INVALID (0) has no row
+            static constexpr std::size_t numberOfGadgetTypes = util::numberOfGadgetTypes - 1;
+
+            GadgetOwnership() = default;
+
+            /**
+             * creates empty matrix (no row has information)
+             * @param characters characters in column order, floor and unassigned column are appended
+             */
+            explicit GadgetOwnership(std::vector<spy::util::UUID> characters);
+
+            [[nodiscard]] std::size_t getNumberOfColumns() const;
+
+            [[nodiscard]] std::size_t getFloorColumn() const;
+
+            /**
+             * @return column with the probability that the gadget is neither at one of the characters nor on the floor
+             *         as far as known
+             */
+            [[nodiscard]] std::size_t getUnassignedColumn() const;
+
+            [[nodiscard]] const std::vector<spy::util::UUID> &getCharacters() const;
+
+            /**
+             * @param id id of character
+             * @return column of character, nullopt if character is unknown
+             */
+            [[nodiscard]] std::optional<std::size_t> getColumn(const spy::util::UUID &id) const;
+
+            /**
+             * @param type gadget type
+             * @return pointer to first of getNumberOfColumns() probabilities of the row, nullptr for INVALID
+             */
+            [[nodiscard]] const double *getRow(spy::gadget::GadgetEnum type) const;
+
+            /**
+             * @param type gadget type
+             * @return true if anything is known about the location of the gadget
+             */
+            [[nodiscard]] bool hasInformation(spy::gadget::GadgetEnum type) const;
+
+            /**
+             * find out how certain it is that given character has given gadget
+             * @return nullopt if no info available or character unknown, else probability
+             */
+            [[nodiscard]] std::optional<double>
+            getProbability(const spy::util::UUID &id, spy::gadget::GadgetEnum type) const;
+
+            /**
+             * @return nullopt if no info available, else probability that gadget lies on the floor
+             */
+            [[nodiscard]] std::optional<double> getFloorProbability(spy::gadget::GadgetEnum type) const;
+
+            /**
+             * sets row to certain location
+             * @param type gadget type
+             * @param column column owning the gadget
+             * @return false if type is INVALID or column does not exist (matrix is unchanged)
+             */
+            bool setCertain(spy::gadget::GadgetEnum type, std::size_t column);
+
+            /**
+             * overwrites row with probabilities, mass missing to 1 is added to the unassigned column, rows summing up
+             * to more than 1 are normalized, rows without any mass loose their information
+             * @param type gadget type
+             * @param weights getNumberOfColumns() non negative probabilities
+             * @return false if type is INVALID or number of weights is wrong (matrix is unchanged)
+             */
+            bool setRow(spy::gadget::GadgetEnum type, const std::vector<double> &weights);
+
+            /**
+             * multiplies row element wise with likelihoods and normalizes it (bayesian update)
+             * @param type gadget type
+             * @param likelihoods getNumberOfColumns() non negative likelihoods
+             * @return false if type is INVALID or number of likelihoods is wrong (matrix is unchanged)
+             */
+            bool updateRow(spy::gadget::GadgetEnum type, const std::vector<double> &likelihoods);
+
+            /**
+             * removes row information (gadget does not exist anymore or nothing is known)
+             * @param type gadget type
+             * @return false if type is INVALID
+             */
+            bool clearRow(spy::gadget::GadgetEnum type);
+
+            /**
+             * scales each row with information so that it sums up to 1
+             */
+            void normalize();
+
+        private:
+            std::vector<spy::util::UUID> characters;
+            std::size_t columns = 2;
+            std::vector<double> probabilities = std::vector<double>(numberOfGadgetTypes * columns, 0.0);
+            std::vector<bool> information = std::vector<bool>(numberOfGadgetTypes, false);
+
+            /**
+             * @return row of type, nullopt for INVALID
+             */
+            [[nodiscard]] static std::optional<std::size_t> rowIndex(spy::gadget::GadgetEnum type);
+
+            /**
+             * normalizes single row, row without probability mass looses its information
+             * @param row index of row
+             */
+            void normalizeRow(std::size_t row);
+    };
+}
+
+#endif //LIBCLIENT_GADGETOWNERSHIP_HPP
@@ -7,7 +7,7 @@
 #include "datatypes/gameplay/CharacterOperation.hpp"
 #include "datatypes/gameplay/PropertyAction.hpp"
 #include "datatypes/character/PropertyEnum.hpp"
-#include "util/GameLogicUtils.hpp"
+#include "util/OperationDispatch.hpp"
 
 void libclient::model::GameState::handleLastClientOperation(const spy::gameplay::State &s) {
     using spy::gameplay::OperationEnum;
@@ -19,14 +19,12 @@ void libclient::model::GameState::handleLastClientOperation(const spy::gameplay:
 
     for (const auto &base_op : operations_vec) {
         auto op_type = base_op->getType();
-        bool skip = (op_type == OperationEnum::CAT_ACTION
-                     or op_type == OperationEnum::JANITOR_ACTION
-                     or op_type == OperationEnum::EXFILTRATION);
+        const auto *character_op = libclient::util::asCharacterOperation(*base_op);
+        bool skip = (character_op == nullptr or op_type == OperationEnum::EXFILTRATION);
         if (skip) {
             continue;
         }
 
-        const auto &character_op = std::dynamic_pointer_cast<const spy::gameplay::CharacterOperation>(base_op);
         const auto &character_id = character_op->getCharacterId();
 
         // check if executing character is in chosen characters
@@ -46,17 +44,17 @@ void libclient::model::GameState::handleLastClientOperation(const spy::gameplay:
         this->isEnemy = std::nullopt;
 
         // if observation was used, set pair of <isEnemy, UUID of observed char>
-        if (character_op->getType() == OperationEnum::PROPERTY_ACTION) {
-            const auto property_op = std::dynamic_pointer_cast<const spy::gameplay::PropertyAction>(character_op);
+        if (op_type == OperationEnum::PROPERTY_ACTION) {
+            const auto &property_op = static_cast<const spy::gameplay::PropertyAction &>(*character_op);
 
-            if (property_op->getUsedProperty() != spy::character::PropertyEnum::OBSERVATION) {
+            if (property_op.getUsedProperty() != spy::character::PropertyEnum::OBSERVATION) {
                 return;
             }
 
-            if (property_op->getIsEnemy().has_value()) {
-                bool enemy = property_op->getIsEnemy().value();
-                spy::util::UUID id = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(s.getCharacters(),
-                                                                                                property_op->getTarget())->getCharacterId();
+            if (property_op.getIsEnemy().has_value()) {
+                bool enemy = property_op.getIsEnemy().value();
+                spy::util::UUID id = this->characterGrid.find(s.getCharacters(),
+                                                              property_op.getTarget())->getCharacterId();
                 this->isEnemy = std::pair<bool, spy::util::UUID>(enemy, id);
             }
         }
@@ -15,8 +15,17 @@
 #include <datatypes/gameplay/State.hpp>
 #include <datatypes/statistics/Statistics.hpp>
 #include <datatypes/statistics/VictoryEnum.hpp>
+#include <model/Bitboards.hpp>
+#include <model/FloorGadgetIndex.hpp>
+#include <model/CharacterGrid.hpp>
+#include <model/DistanceCache.hpp>
+#include <model/LineOfSightCache.hpp>
+#include <model/Reachability.hpp>
 
 namespace libclient::model {
+    /**
+     * @note not copyable since DistanceCache holds a mutex and a future
+     */
     class GameState {
         public:
             spy::scenario::Scenario level; //set by HelloReply message
@@ -29,6 +38,7 @@ namespace libclient::model {
             std::map<spy::util::UUID, std::set<spy::gadget::GadgetEnum>> equipmentMap; // set by sendEquipmentChoice method
             std::vector<std::shared_ptr<const spy::gameplay::BaseOperation>> operations; //set by GameStatus message
             spy::gameplay::State state; //set by GameStatus message
+            std::size_t stateVersion = 0; // incremented by GameStatus message
             bool isGameOver = false; //set by GameStatus message
             std::optional<spy::util::UUID> winner; //set by Statistics message
             std::optional<spy::statistics::Statistics> statistics; //set by Statistics message
@@ -37,11 +47,17 @@ namespace libclient::model {
             spy::util::UUID lastActiveCharacter; //set by GameStatusMessage
             bool lastOpSuccessful = false; // set by GameStatusMessage
             std::optional<std::pair<bool, spy::util::UUID>> isEnemy;    // set by GameStatusMessage
+            FloorGadgetIndex floorGadgets; // set by GameStatusMessage
+            CharacterGrid characterGrid; // set by GameStatusMessage
+            DistanceCache distances; // set by HelloReply message, patched by GameStatusMessage
+            LineOfSightCache lineOfSight; // set by GameStatusMessage
+            Bitboards bitboards; // set by GameStatusMessage
+            ReachabilityCache reachability; // cleared by GameStatusMessage
 
             /**
              * @brief   Helper function for client, to check if the last operation by the client was successfull
              * @note    To determine success a dynamic ptr cast is needed, which I wasn't able to achieve through cppyy
-             * @param s up to date state without AIState information
+             * @param s up to date state without AIState information (characterGrid has to be built from s)
              * @author  Marco Deuscher (Carolin changed param list)
              */
             void handleLastClientOperation(const spy::gameplay::State &s);
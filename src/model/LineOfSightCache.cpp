@@ -0,0 +1,126 @@
+/**
+ * @file   LineOfSightCache.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the line of sight cache used for gadget and observation targets.
+ */
+
+#include "LineOfSightCache.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <util/GameLogicUtils.hpp>
+#include <util/MemoryUtils.hpp>
+
+namespace libclient::model {
+
+    unsigned int LineOfSightCache::update(const spy::gameplay::State &s) {
+        const auto &rows = s.getMap().getMap();
+        util::FieldIndexer newIndexer(rows);
+
+        bool rebuild = newIndexer != indexer;
+        if (rebuild) {
+            indexer = newIndexer;
+            auto n = indexer.getNumberOfFields();
+            blockers.assign(n, 0);
+            known.assign(n, util::Bitset(n));
+            visible.assign(n, util::Bitset(n));
+        }
+
+        unsigned int changed = 0;
+        for (auto y = 0U; y < rows.size(); y++) {
+            for (auto x = 0U; x < rows[y].size(); x++) {
+                const auto &field = rows[y][x];
+                auto blocker = static_cast<std::uint8_t>((static_cast<unsigned int>(field.getFieldState()) << 1U) |
+                                                         (field.isFoggy() ? 1U : 0U));
+                auto index = indexer.getIndex(x, y);
+                if (blocker != blockers[index]) {
+                    blockers[index] = blocker;
+                    if (!rebuild) {
+                        invalidate(index);
+                    }
+                    changed++;
+                }
+            }
+        }
+        return changed;
+    }
+
+    bool LineOfSightCache::isInSight(const spy::gameplay::State &s, const spy::util::Point &from,
+                                     const spy::util::Point &to) {
+        auto a = indexer.getIndex(from);
+        auto b = indexer.getIndex(to);
+        if (!a.has_value() || !b.has_value()) {
+            return false;
+        }
+
+        if (!known[a.value()].test(b.value())) {
+            bool inSight = spy::util::GameLogicUtils::isInSight(s, from, to);
+            rayTests++;
+            // sight is symmetric
+            known[a.value()].set(b.value());
+            known[b.value()].set(a.value());
+            visible[a.value()].set(b.value(), inSight);
+            visible[b.value()].set(a.value(), inSight);
+        }
+        return visible[a.value()].test(b.value());
+    }
+
+    std::vector<spy::util::Point> LineOfSightCache::getFieldsInSight(const spy::gameplay::State &s,
+                                                                     const spy::util::Point &from,
+                                                                     unsigned int range) {
+        std::vector<spy::util::Point> fields;
+        if (!indexer.getIndex(from).has_value()) {
+            return fields;
+        }
+
+        auto width = static_cast<long>(indexer.getWidth());
+        auto height = static_cast<long>(indexer.getHeight());
+        auto r = range == 0 ? std::max(width, height) : static_cast<long>(range);
+        auto minX = std::max(0L, from.x - r);
+        auto maxX = std::min(width - 1, from.x + r);
+        auto minY = std::max(0L, from.y - r);
+        auto maxY = std::min(height - 1, from.y + r);
+        for (auto y = minY; y <= maxY; y++) {
+            for (auto x = minX; x <= maxX; x++) {
+                spy::util::Point p{static_cast<int>(x), static_cast<int>(y)};
+                if (p != from && isInSight(s, from, p)) {
+                    fields.push_back(p);
+                }
+            }
+        }
+        return fields;
+    }
+
+    std::size_t LineOfSightCache::getNumberOfRayTests() const {
+        return rayTests;
+    }
+
+    std::size_t LineOfSightCache::getSizeInBytes() const {
+        auto size = util::capacityInBytes(blockers) + util::capacityInBytes(known) + util::capacityInBytes(visible);
+        for (const auto &bits: known) {
+            size += util::capacityInBytes(bits.getWords());
+        }
+        for (const auto &bits: visible) {
+            size += util::capacityInBytes(bits.getWords());
+        }
+        return size;
+    }
+
+    void LineOfSightCache::invalidate(std::size_t changed) {
+        auto c = indexer.getPoint(changed);
+        // a ray from a to b only passes fields inside the bounding box of a and b
+        for (std::size_t a = 0; a < known.size(); a++) {
+            auto p = indexer.getPoint(a);
+            // fields in the same column or row as c may look past it in both directions
+            auto minX = p.x < c.x ? c.x : 0;
+            auto maxX = p.x > c.x ? c.x : static_cast<int>(indexer.getWidth()) - 1;
+            auto minY = p.y < c.y ? c.y : 0;
+            auto maxY = p.y > c.y ? c.y : static_cast<int>(indexer.getHeight()) - 1;
+            for (auto y = minY; y <= maxY; y++) {
+                for (auto x = minX; x <= maxX; x++) {
+                    known[a].reset(indexer.getIndex(static_cast<std::size_t>(x), static_cast<std::size_t>(y)));
+                }
+            }
+        }
+    }
+}
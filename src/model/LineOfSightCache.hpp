@@ -0,0 +1,77 @@
+/**
+ * @file   LineOfSightCache.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the line of sight cache used for gadget and observation targets.
+ */
+
+#ifndef LIBCLIENT_LINEOFSIGHTCACHE_HPP
+#define LIBCLIENT_LINEOFSIGHTCACHE_HPP
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <datatypes/gameplay/State.hpp>
+#include <util/Bitset.hpp>
+#include <util/FieldIndexer.hpp>
+
+namespace libclient::model {
+
+    /**
+     * caches spy::util::GameLogicUtils::isInSight for pairs of fields as one visibility bitset per field
+     * rays are traced lazily on first query, when walls or fog change only pairs whose bounding box contains the
+     * changed field are invalidated
+     * characters are not taken into account (use CharacterGrid for gadgets that need a free line)
+     */
+    class LineOfSightCache {
+        public:
+            /**
+             * compares walls and fog of s with the cached state and invalidates affected pairs
+             * (first call sets up the cache for the level)
+             * @param s current state
+             * @return number of fields whose walls or fog changed
+             */
+            unsigned int update(const spy::gameplay::State &s);
+
+            /**
+             * @param s state cache was last updated with
+             * @param from field of the observer
+             * @param to target field
+             * @return true if to is in sight of from
+             */
+            bool isInSight(const spy::gameplay::State &s, const spy::util::Point &from, const spy::util::Point &to);
+
+            /**
+             * @param s state cache was last updated with
+             * @param from field of the observer
+             * @param range maximal distance (number of king moves) of fields, 0 for no limit
+             * @return all fields in range that are in sight of from
+             */
+            std::vector<spy::util::Point> getFieldsInSight(const spy::gameplay::State &s,
+                                                           const spy::util::Point &from, unsigned int range = 0);
+
+            /**
+             * @return number of rays traced so far (cache misses)
+             */
+            [[nodiscard]] std::size_t getNumberOfRayTests() const;
+
+            /**
+             * @return approximate heap memory of the cache in bytes
+             */
+            [[nodiscard]] std::size_t getSizeInBytes() const;
+
+        private:
+            util::FieldIndexer indexer;
+            std::vector<std::uint8_t> blockers; // field state and fog per field
+            std::vector<util::Bitset> known; // per field: pairs with traced ray
+            std::vector<util::Bitset> visible; // per field: result of traced rays
+            std::size_t rayTests = 0;
+
+            /**
+             * forgets rays that may pass the changed field
+             */
+            void invalidate(std::size_t changed);
+    };
+}
+
+#endif //LIBCLIENT_LINEOFSIGHTCACHE_HPP
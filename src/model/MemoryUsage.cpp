@@ -0,0 +1,165 @@
+/**
+ * @file   MemoryUsage.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the memory accounting of the model.
+ */
+
+#include "MemoryUsage.hpp"
+#include <algorithm>
+#include <model/Model.hpp>
+#include <util/MemoryUtils.hpp>
+#include <util/OperationDispatch.hpp>
+
+namespace libclient::model {
+
+    namespace {
+        template<typename Set>
+        std::size_t treeSize(const Set &set) {
+            return set.size() * (util::treeNodeOverhead + sizeof(typename Set::value_type));
+        }
+
+        std::size_t gadgetSize(const std::shared_ptr<spy::gadget::Gadget> &gadget) {
+            return gadget == nullptr ? 0 : util::sharedControlBlock + sizeof(spy::gadget::Gadget);
+        }
+
+        std::size_t operationsSize(const std::vector<std::shared_ptr<const spy::gameplay::BaseOperation>> &ops) {
+            auto size = util::capacityInBytes(ops);
+            for (const auto &op: ops) {
+                if (op != nullptr) {
+                    size += util::sharedControlBlock + util::visitOperation(*op, [](const auto &o) {
+                        return sizeof(o);
+                    });
+                }
+            }
+            return size;
+        }
+
+        std::size_t stateSize(const spy::gameplay::State &s) {
+            const auto &rows = s.getMap().getMap();
+            auto size = util::capacityInBytes(rows);
+            for (const auto &row: rows) {
+                size += util::capacityInBytes(row);
+                for (const auto &f: row) {
+                    if (f.getGadget().has_value()) {
+                        size += gadgetSize(f.getGadget().value());
+                    }
+                }
+            }
+            for (const auto &c: s.getCharacters()) {
+                size += sizeof(c);
+                for (const auto &gadget: c.getGadgets()) {
+                    size += sizeof(gadget) + gadgetSize(gadget);
+                }
+            }
+            return size;
+        }
+
+        std::size_t gameStateSize(const GameState &game) {
+            auto size = sizeof(GameState) + stateSize(game.state) + operationsSize(game.operations);
+            const auto &level = game.level.getScenario();
+            size += util::capacityInBytes(level);
+            for (const auto &row: level) {
+                size += util::capacityInBytes(row);
+            }
+            size += util::capacityInBytes(game.characterSettings) + util::capacityInBytes(game.offeredCharacters) +
+                    util::capacityInBytes(game.offeredGadgets) + util::capacityInBytes(game.chosenCharacter) +
+                    util::capacityInBytes(game.chosenGadget) + treeSize(game.equipmentMap);
+            for (const auto &[id, gadgets]: game.equipmentMap) {
+                size += treeSize(gadgets);
+            }
+            size += game.distances.getSizeInBytes() + game.lineOfSight.getSizeInBytes() +
+                    game.reachability.getSizeInBytes() + game.floorGadgets.getSizeInBytes() +
+                    game.bitboards.getSizeInBytes();
+            return size;
+        }
+
+        std::size_t beliefsSize(const std::vector<std::pair<spy::util::UUID, std::vector<double>>> &beliefs,
+                                std::size_t &numberOfBeliefs) {
+            auto size = util::capacityInBytes(beliefs);
+            for (const auto &[id, certainties]: beliefs) {
+                size += util::capacityInBytes(certainties);
+                numberOfBeliefs += certainties.size();
+            }
+            return size;
+        }
+
+        std::size_t aiStateSize(const AIState &ai, std::size_t &numberOfBeliefs) {
+            auto size = sizeof(AIState) + treeSize(ai.unknownFaction);
+            for (const auto &[id, factions]: ai.unknownFaction) {
+                size += util::capacityInBytes(factions);
+                for (const auto &[faction, certainties]: factions) {
+                    size += util::capacityInBytes(certainties);
+                    numberOfBeliefs += certainties.size();
+                }
+            }
+            size += treeSize(ai.unknownGadgets);
+            for (const auto &[gadget, beliefs]: ai.unknownGadgets) {
+                size += gadgetSize(gadget) + beliefsSize(beliefs, numberOfBeliefs);
+            }
+            size += treeSize(ai.characterGadgets);
+            for (const auto &entry: ai.characterGadgets) {
+                size += gadgetSize(entry.first);
+            }
+            size += treeSize(ai.floorGadgets);
+            for (const auto &gadget: ai.floorGadgets) {
+                size += gadgetSize(gadget);
+            }
+
+            size += treeSize(ai.myFaction) + treeSize(ai.enemyFaction) + treeSize(ai.npcFaction) +
+                    treeSize(ai.excludedFactions) + treeSize(ai.properties);
+            for (const auto &entry: ai.excludedFactions) {
+                size += treeSize(entry.second);
+            }
+            for (const auto &entry: ai.properties) {
+                size += treeSize(entry.second);
+            }
+            size += util::capacityInBytes(ai.poisonedCocktails) + treeSize(ai.openedSafes) +
+                    treeSize(ai.triedSafes) + treeSize(ai.safeCombinations) + treeSize(ai.openedSafesTotal) +
+                    treeSize(ai.combinationsFromNpcs) + ai.safes.getSizeInBytes();
+            return size;
+        }
+
+        std::size_t clientStateSize(const ClientState &client) {
+            auto size = sizeof(ClientState) + util::capacityInBytes(client.name) +
+                        util::capacityInBytes(client.playerOneName) + util::capacityInBytes(client.playerTwoName) +
+                        util::capacityInBytes(client.strikeReason) + treeSize(client.information);
+            if (client.debugMessage.has_value()) {
+                size += util::capacityInBytes(client.debugMessage.value());
+            }
+            return size;
+        }
+    }
+
+    std::size_t MemoryUsage::getTotal() const {
+        return gameState + aiState + clientState + replay + caches;
+    }
+
+    void MemoryUsage::updateMaximum(const MemoryUsage &other) {
+        gameState = std::max(gameState, other.gameState);
+        operations = std::max(operations, other.operations);
+        aiState = std::max(aiState, other.aiState);
+        clientState = std::max(clientState, other.clientState);
+        replay = std::max(replay, other.replay);
+        caches = std::max(caches, other.caches);
+        numberOfOperations = std::max(numberOfOperations, other.numberOfOperations);
+        numberOfBeliefs = std::max(numberOfBeliefs, other.numberOfBeliefs);
+        numberOfInformation = std::max(numberOfInformation, other.numberOfInformation);
+    }
+
+    MemoryUsage measureMemoryUsage(const libclient::Model &model) {
+        MemoryUsage usage;
+        usage.gameState = gameStateSize(model.gameState);
+        usage.operations = operationsSize(model.gameState.operations);
+        usage.numberOfOperations = model.gameState.operations.size();
+        usage.aiState = aiStateSize(model.aiState, usage.numberOfBeliefs);
+        usage.clientState = clientStateSize(model.clientState);
+        usage.numberOfInformation = model.clientState.information.size();
+        if (model.replay.has_value()) {
+            usage.replay = model.replaySize;
+        }
+        usage.caches = sizeof(SafePlanner) + sizeof(OperationGenerator) + sizeof(ValidationCache) +
+                       model.validationCache.getSizeInBytes();
+        return usage;
+    }
+}
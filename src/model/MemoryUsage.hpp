@@ -0,0 +1,52 @@
+/**
+ * @file   MemoryUsage.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the memory accounting of the model.
+ */
+
+#ifndef LIBCLIENT_MEMORYUSAGE_HPP
+#define LIBCLIENT_MEMORYUSAGE_HPP
+
+#include <cstddef>
+
+namespace libclient {
+    class Model;
+}
+
+namespace libclient::model {
+
+    /**
+     * approximate memory of the model components in bytes (objects and the heap memory of their containers)
+     */
+    struct MemoryUsage {
+        std::size_t gameState = 0; // including operations, state, level, caches, bitboards and floor index of GameState
+        std::size_t operations = 0; // part of gameState, grows with match length
+        std::size_t aiState = 0; // including safe registry
+        std::size_t clientState = 0;
+        std::size_t replay = 0; // size of the received REPLAY message
+        std::size_t caches = 0; // SafePlanner, OperationGenerator and ValidationCache
+        std::size_t numberOfOperations = 0; // in GameState::operations
+        std::size_t numberOfBeliefs = 0; // certainties in AIState::unknownFaction and AIState::unknownGadgets
+        std::size_t numberOfInformation = 0; // entries of ClientState::information
+
+        [[nodiscard]] std::size_t getTotal() const;
+
+        /**
+         * sets every member to the maximum of this and other (high water mark)
+         */
+        void updateMaximum(const MemoryUsage &other);
+    };
+
+    /**
+     * walks all containers of model (cost grows with match length), objects of LibCommon are counted with their
+     * object size and the containers reachable by their getters
+     * not counted: undo log of AIState checkpoints and everything owned by callers instead of the model
+     * (particles of a BeliefSampler, GadgetOwnership matrices, RootBanditSearch and its transposition table)
+     * @param model model to be measured
+     * @return approximate memory per component
+     */
+    [[nodiscard]] MemoryUsage measureMemoryUsage(const libclient::Model &model);
+}
+
+#endif //LIBCLIENT_MEMORYUSAGE_HPP
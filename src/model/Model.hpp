@@ -11,7 +11,16 @@
 #include <model/AIState.hpp>
 #include <model/ClientState.hpp>
 #include <model/GameState.hpp>
+#include <model/MemoryUsage.hpp>
+#include <model/OperationGenerator.hpp>
+#include <model/SafePlanner.hpp>
+#include <model/RootBanditSearch.hpp>
+#include <model/Simulator.hpp>
+#include <model/ValidationCache.hpp>
+#include <network/messages/MessageTypeEnum.hpp>
 #include <network/messages/Replay.hpp>
+#include <util/AllocationCounter.hpp>
+#include <atomic>
 
 namespace libclient {
     class Model {
@@ -20,6 +29,16 @@ namespace libclient {
             model::ClientState clientState;
             model::GameState gameState;
             std::optional<spy::network::messages::Replay> replay; // set by REPLAY message
+            std::size_t replaySize = 0; // size of the REPLAY message, estimate of the memory of replay
+            model::SafePlanner safePlanner; // caches safe plan between calls of LibClient::getSafePlan
+            model::OperationGenerator operationGenerator; // caches legal operations per RequestGameOperation
+            model::ValidationCache validationCache; // used by sendGameOperation method
+            bool trackMemory = false; // set by LibClient::setMemoryTracking
+            model::MemoryUsage memoryPeak; // updated after every message if trackMemory is set
+            std::atomic<bool> countAllocations{false}; // set by LibClient::setAllocationCounting
+            // allocations per type of handled message (including callbacks) and per type of sent message
+            util::AllocationRegistry<spy::network::messages::MessageTypeEnum> receivedAllocations;
+            util::AllocationRegistry<spy::network::messages::MessageTypeEnum> sentAllocations;
     };
 }
 
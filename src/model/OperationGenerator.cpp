@@ -0,0 +1,254 @@
+/**
+ * @file   OperationGenerator.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the generator of all legal operations of the active character.
+ */
+
+#include "OperationGenerator.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <datatypes/gameplay/Movement.hpp>
+#include <datatypes/gameplay/GadgetAction.hpp>
+#include <datatypes/gameplay/SpyAction.hpp>
+#include <datatypes/gameplay/GambleAction.hpp>
+#include <datatypes/gameplay/PropertyAction.hpp>
+#include <datatypes/gameplay/RetireAction.hpp>
+#include <gameLogic/validation/ActionValidator.hpp>
+
+namespace libclient::model {
+
+    namespace {
+        using spy::gameplay::ActionValidator;
+
+        bool isValid(const spy::gameplay::State &s, const std::shared_ptr<const spy::gameplay::Movement> &op) {
+            return ActionValidator::validateMovement(s, op);
+        }
+
+        bool isValid(const spy::gameplay::State &s, const std::shared_ptr<const spy::gameplay::GadgetAction> &op) {
+            return ActionValidator::validateGadgetAction(s, op);
+        }
+
+        bool isValid(const spy::gameplay::State &s, const std::shared_ptr<const spy::gameplay::SpyAction> &op) {
+            return ActionValidator::validateSpyAction(s, op);
+        }
+
+        bool isValid(const spy::gameplay::State &s, const std::shared_ptr<const spy::gameplay::GambleAction> &op) {
+            return ActionValidator::validateGambleAction(s, op);
+        }
+
+        bool isValid(const spy::gameplay::State &s, const std::shared_ptr<const spy::gameplay::PropertyAction> &op) {
+            return ActionValidator::validatePropertyAction(s, op);
+        }
+
+        bool isValid(const spy::gameplay::State &s, const std::shared_ptr<const spy::gameplay::RetireAction> &op) {
+            return ActionValidator::validateRetireAction(s, op);
+        }
+
+        /**
+         * king distance is not larger than euclidean or manhattan distance, so filtering by it never drops a
+         * target the validator accepts
+         */
+        bool isInRange(const spy::util::Point &a, const spy::util::Point &b, unsigned int range) {
+            return static_cast<unsigned int>(std::max(std::abs(a.x - b.x), std::abs(a.y - b.y))) <= range;
+        }
+    }
+
+    template<typename Operation>
+    void OperationGenerator::addIfValid(std::shared_ptr<Operation> candidate, const spy::gameplay::State &s) {
+        candidates++;
+        if (isValid(s, std::shared_ptr<const Operation>(candidate))) {
+            operations.push_back(std::move(candidate));
+        }
+    }
+
+    const std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> &
+    OperationGenerator::generate(GameState &game, const ClientState &client) {
+        auto key = std::make_pair(client.activeCharacter, game.stateVersion);
+        if (cachedKey.has_value() && cachedKey.value() == key) {
+            return operations;
+        }
+        cachedKey = key;
+        operations.clear();
+        candidates = 0;
+
+        // role and active character are checked once instead of per candidate (GameOperation::validate)
+        const auto &s = game.state;
+        auto character = s.getCharacters().findByUUID(client.activeCharacter);
+        if (!client.id.has_value() || client.role == spy::network::RoleEnum::SPECTATOR ||
+            character == s.getCharacters().end() || !character->getCoordinates().has_value()) {
+            return operations;
+        }
+        const auto &id = client.activeCharacter;
+        const auto position = character->getCoordinates().value();
+        const auto &boards = game.bitboards;
+
+        const auto neighbourSet = boards.getNeighbours(position);
+        const auto neighbours = boards.toPoints(neighbourSet);
+        const auto neighbourPersons = boards.toPoints(neighbourSet & boards.get(BitboardLayer::OCCUPIED));
+        const auto inSight = game.lineOfSight.getFieldsInSight(s, position);
+
+        // movements (one field per operation)
+        auto walkable = boards.getWalkable() & neighbourSet;
+        for (const auto &target: boards.toPoints(walkable)) {
+            addIfValid(std::make_shared<spy::gameplay::Movement>(false, target, id, position), s);
+        }
+
+        // gadget actions, targets are filtered by range and type of the target before an action is created
+        auto sightTargets = [&boards, &inSight, &position](std::optional<BitboardLayer> layer,
+                                                           std::optional<unsigned int> range) {
+            std::vector<spy::util::Point> targets;
+            for (const auto &p: inSight) {
+                if ((!layer.has_value() || boards.test(layer.value(), p)) &&
+                    (!range.has_value() || isInRange(p, position, range.value()))) {
+                    targets.push_back(p);
+                }
+            }
+            return targets;
+        };
+        auto withPosition = [&position](std::vector<spy::util::Point> targets) {
+            targets.push_back(position);
+            return targets;
+        };
+        auto neighbourCocktails = [&boards, &neighbours]() {
+            std::vector<spy::util::Point> targets;
+            for (const auto &p: neighbours) {
+                if (boards.test(BitboardLayer::OCCUPIED, p) ||
+                    (boards.test(BitboardLayer::BAR_TABLE, p) && boards.test(BitboardLayer::GADGET, p))) {
+                    targets.push_back(p);
+                }
+            }
+            return targets;
+        };
+
+        const auto &config = game.settings;
+        for (const auto &gadget: character->getGadgets()) {
+            using spy::gadget::GadgetEnum;
+
+            std::vector<spy::util::Point> targets;
+            switch (gadget->getType()) {
+                case GadgetEnum::HAIRDRYER:
+                case GadgetEnum::COCKTAIL:
+                    targets = withPosition(neighbourPersons);
+                    break;
+                case GadgetEnum::GAS_GLOSS:
+                case GadgetEnum::WIRETAP_WITH_EARPLUGS:
+                case GadgetEnum::CHICKEN_FEED:
+                case GadgetEnum::NUGGET:
+                case GadgetEnum::MIRROR_OF_WILDERNESS:
+                    targets = neighbourPersons;
+                    break;
+                case GadgetEnum::POISON_PILLS:
+                    targets = neighbourCocktails();
+                    break;
+                case GadgetEnum::TECHNICOLOUR_PRISM:
+                    targets = boards.toPoints(neighbourSet & boards.get(BitboardLayer::ROULETTE_TABLE));
+                    break;
+                case GadgetEnum::MOLEDIE:
+                    targets = sightTargets(std::nullopt, config.getMoledieRange());
+                    break;
+                case GadgetEnum::BOWLER_BLADE:
+                    targets = sightTargets(BitboardLayer::OCCUPIED, config.getBowlerBladeRange());
+                    break;
+                case GadgetEnum::LASER_COMPACT: {
+                    for (const auto &p: inSight) {
+                        if (boards.test(BitboardLayer::OCCUPIED, p) ||
+                            (boards.test(BitboardLayer::BAR_TABLE, p) && boards.test(BitboardLayer::GADGET, p))) {
+                            targets.push_back(p);
+                        }
+                    }
+                    break;
+                }
+                case GadgetEnum::ROCKET_PEN:
+                    targets = sightTargets(std::nullopt, std::nullopt);
+                    break;
+                case GadgetEnum::MOTHBALL_POUCH:
+                    targets = sightTargets(BitboardLayer::FIREPLACE, config.getMothballPouchRange());
+                    break;
+                case GadgetEnum::FOG_TIN:
+                    targets = sightTargets(std::nullopt, config.getFogTinRange());
+                    break;
+                case GadgetEnum::GRAPPLE:
+                    targets = sightTargets(BitboardLayer::GADGET, config.getGrappleRange());
+                    break;
+                case GadgetEnum::JETPACK: {
+                    // any free field of the map, no line of sight needed
+                    auto free = boards.get(BitboardLayer::FREE);
+                    free.subtract(boards.get(BitboardLayer::OCCUPIED));
+                    targets = boards.toPoints(free);
+                    break;
+                }
+                case GadgetEnum::MAGNETIC_WATCH:
+                case GadgetEnum::DIAMOND_COLLAR:
+                case GadgetEnum::POCKET_LITTER:
+                    // passive gadgets
+                    break;
+                default:
+                    targets = withPosition(neighbours);
+                    targets.insert(targets.end(), inSight.begin(), inSight.end());
+                    break;
+            }
+
+            for (const auto &target: targets) {
+                addIfValid(std::make_shared<spy::gameplay::GadgetAction>(false, target, id, gadget->getType()), s);
+            }
+        }
+
+        // cocktails can be taken from bar tables next to character without holding one
+        for (const auto &target: neighbours) {
+            if (boards.test(BitboardLayer::BAR_TABLE, target) && boards.test(BitboardLayer::GADGET, target)) {
+                addIfValid(std::make_shared<spy::gameplay::GadgetAction>(false, target, id,
+                                                                         spy::gadget::GadgetEnum::COCKTAIL), s);
+            }
+        }
+
+        // spy actions on persons and safes next to character
+        for (const auto &target: neighbours) {
+            if (boards.test(BitboardLayer::OCCUPIED, target) || boards.test(BitboardLayer::SAFE, target)) {
+                addIfValid(std::make_shared<spy::gameplay::SpyAction>(false, target, id), s);
+            }
+        }
+
+        // gamble and bang and burn at roulette tables next to character
+        std::vector<unsigned int> stakesToTry = stakes;
+        if (stakesToTry.empty()) {
+            auto chips = character->getChips();
+            stakesToTry = {1, chips / 2, chips};
+        }
+        std::sort(stakesToTry.begin(), stakesToTry.end());
+        stakesToTry.erase(std::unique(stakesToTry.begin(), stakesToTry.end()), stakesToTry.end());
+        for (const auto &target: boards.toPoints(neighbourSet & boards.get(BitboardLayer::ROULETTE_TABLE))) {
+            for (auto stake: stakesToTry) {
+                if (stake > 0 && stake <= character->getChips()) {
+                    addIfValid(std::make_shared<spy::gameplay::GambleAction>(false, target, id, stake), s);
+                }
+            }
+            addIfValid(std::make_shared<spy::gameplay::PropertyAction>(false, target, id,
+                                                                       spy::character::PropertyEnum::BANG_AND_BURN),
+                       s);
+        }
+
+        // observation of persons in sight
+        for (const auto &target: sightTargets(BitboardLayer::OCCUPIED, std::nullopt)) {
+            addIfValid(std::make_shared<spy::gameplay::PropertyAction>(false, target, id,
+                                                                       spy::character::PropertyEnum::OBSERVATION),
+                       s);
+        }
+
+        addIfValid(std::make_shared<spy::gameplay::RetireAction>(false, position, id), s);
+        return operations;
+    }
+
+    void OperationGenerator::setGambleStakes(std::vector<unsigned int> stakeList) {
+        stakes = std::move(stakeList);
+        invalidate();
+    }
+
+    void OperationGenerator::invalidate() {
+        cachedKey.reset();
+    }
+
+    std::size_t OperationGenerator::getNumberOfCandidates() const {
+        return candidates;
+    }
+}
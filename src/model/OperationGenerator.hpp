@@ -0,0 +1,67 @@
+/**
+ * @file   OperationGenerator.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the generator of all legal operations of the active character.
+ */
+
+#ifndef LIBCLIENT_OPERATIONGENERATOR_HPP
+#define LIBCLIENT_OPERATIONGENERATOR_HPP
+
+#include <memory>
+#include <vector>
+#include <datatypes/gameplay/BaseOperation.hpp>
+#include <model/ClientState.hpp>
+#include <model/GameState.hpp>
+
+namespace libclient::model {
+
+    /**
+     * enumerates all legal operations of the active character: movements, gadget actions (including taking a
+     * cocktail from a bar table), spy actions, gamble actions, property actions and retire
+     * candidate targets are pruned with the bitboards, the line of sight cache and the gadget ranges of the match
+     * config before an operation is created, then checked with the action validator of its type (role and active
+     * character are checked once), the result is cached until the next request or GameStatus message
+     */
+    class OperationGenerator {
+        public:
+            /**
+             * @param game game state (bitboards and line of sight cache have to be up to date)
+             * @param client client state with active character
+             * @return legal operations, empty if client is not allowed to make an operation
+             */
+            const std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> &
+            generate(GameState &game, const ClientState &client);
+
+            /**
+             * @param stakeList stakes to generate gamble actions for, empty for 1, half and all chips
+             */
+            void setGambleStakes(std::vector<unsigned int> stakeList);
+
+            /**
+             * forces generation on next call of generate
+             */
+            void invalidate();
+
+            /**
+             * @return number of candidate operations validated by the last generation
+             */
+            [[nodiscard]] std::size_t getNumberOfCandidates() const;
+
+        private:
+            std::optional<std::pair<spy::util::UUID, std::size_t>> cachedKey; // active character, state version
+            std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> operations;
+            std::vector<unsigned int> stakes;
+            std::size_t candidates = 0;
+
+            /**
+             * validates candidate with the action validator of its type and appends it to operations if it is legal
+             * @param candidate operation of the active character
+             * @param s current state
+             */
+            template<typename Operation>
+            void addIfValid(std::shared_ptr<Operation> candidate, const spy::gameplay::State &s);
+    };
+}
+
+#endif //LIBCLIENT_OPERATIONGENERATOR_HPP
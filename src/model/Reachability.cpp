@@ -0,0 +1,117 @@
+/**
+ * @file   Reachability.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the movement reachability sets computed by bit parallel flood fill.
+ */
+
+#include "Reachability.hpp"
+#include <algorithm>
+#include <util/MemoryUtils.hpp>
+
+namespace libclient::model {
+
+    std::optional<unsigned int> Reachability::getDistance(std::size_t index) const {
+        for (std::size_t k = 0; k < steps.size(); k++) {
+            if (steps[k].test(index)) {
+                return static_cast<unsigned int>(k);
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::optional<std::vector<spy::util::Point>> Reachability::getPath(const Bitboards &boards,
+                                                                       const spy::util::Point &target) const {
+        auto index = boards.getIndex(target);
+        if (!index.has_value()) {
+            return std::nullopt;
+        }
+        auto distance = getDistance(index.value());
+        if (!distance.has_value()) {
+            return std::nullopt;
+        }
+
+        // walk back one ring at a time
+        std::vector<spy::util::Point> path(distance.value());
+        auto current = target;
+        for (auto k = distance.value(); k > 0; k--) {
+            path[k - 1] = current;
+            auto previous = boards.getNeighbours(current) & steps[k - 1];
+            std::optional<std::size_t> first;
+            previous.forEach([&first](std::size_t i) {
+                if (!first.has_value()) {
+                    first = i;
+                }
+            });
+            current = boards.getPoint(first.value());
+        }
+        return path;
+    }
+
+    std::shared_ptr<const Reachability> ReachabilityCache::get(const Bitboards &boards, const spy::gameplay::State &s,
+                                                               const spy::util::UUID &id, unsigned int movePoints,
+                                                               bool passOccupied) {
+        auto key = std::make_tuple(id, movePoints, passOccupied);
+        auto it = cache.find(key);
+        if (it == cache.end()) {
+            it = cache.emplace(key, compute(boards, s, id, movePoints, passOccupied)).first;
+        }
+        return it->second;
+    }
+
+    void ReachabilityCache::clear() {
+        cache.clear();
+    }
+
+    std::size_t ReachabilityCache::getSizeInBytes() const {
+        std::size_t size = 0;
+        for (const auto &entry: cache) {
+            size += util::treeNodeOverhead + sizeof(entry);
+            if (entry.second != nullptr) {
+                const auto &r = *entry.second;
+                size += util::sharedControlBlock + sizeof(Reachability) + util::capacityInBytes(r.reachable.getWords()) + util::capacityInBytes(r.steps);
+                for (const auto &step: r.steps) {
+                    size += util::capacityInBytes(step.getWords());
+                }
+            }
+        }
+        return size;
+    }
+
+    std::shared_ptr<const Reachability>
+    ReachabilityCache::compute(const Bitboards &boards, const spy::gameplay::State &s, const spy::util::UUID &id,
+                               unsigned int movePoints, bool passOccupied) {
+        auto character = s.getCharacters().findByUUID(id);
+        if (character == s.getCharacters().end() || !character->getCoordinates().has_value()) {
+            return nullptr;
+        }
+        auto start = boards.getIndex(character->getCoordinates().value());
+        if (!start.has_value()) {
+            return nullptr;
+        }
+
+        auto passable = boards.getWalkable();
+        if (!passOccupied) {
+            passable.subtract(boards.get(BitboardLayer::OCCUPIED));
+        }
+
+        auto reachability = std::make_shared<Reachability>();
+        auto &result = *reachability;
+        result.start = character->getCoordinates().value();
+        result.reachable = boards.makeSet();
+        result.reachable.set(start.value());
+        result.steps.push_back(result.reachable);
+
+        for (unsigned int k = 1; k <= movePoints; k++) {
+            auto ring = boards.expand(result.steps.back());
+            ring &= passable;
+            ring.subtract(result.reachable);
+            if (ring.none()) {
+                break;
+            }
+            result.reachable |= ring;
+            result.steps.push_back(std::move(ring));
+        }
+        return reachability;
+    }
+}
@@ -0,0 +1,81 @@
+/**
+ * @file   Reachability.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the movement reachability sets computed by bit parallel flood fill.
+ */
+
+#ifndef LIBCLIENT_REACHABILITY_HPP
+#define LIBCLIENT_REACHABILITY_HPP
+
+#include <map>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <model/Bitboards.hpp>
+
+namespace libclient::model {
+
+    /**
+     * fields a character can reach with a movement budget
+     */
+    struct Reachability {
+        spy::util::Point start;
+        util::Bitset reachable; // all fields reachable within budget (including start)
+        std::vector<util::Bitset> steps; // steps[k]: fields reached with exactly k movement points
+
+        /**
+         * @param index field index (see Bitboards::getIndex)
+         * @return number of movement points needed, nullopt if not reachable within budget
+         */
+        [[nodiscard]] std::optional<unsigned int> getDistance(std::size_t index) const;
+
+        /**
+         * @param boards bitboards the reachability was computed on
+         * @param target target field
+         * @return fields of a cheapest path from start (exclusive) to target (inclusive), nullopt if not reachable
+         */
+        [[nodiscard]] std::optional<std::vector<spy::util::Point>> getPath(const Bitboards &boards,
+                                                                            const spy::util::Point &target) const;
+    };
+
+    /**
+     * flood fills the walkable layer one ring per movement point with word parallel bit operations,
+     * results are cached per character and budget until the next GameStatus message, results are shared and stay
+     * valid after the cache is cleared
+     */
+    class ReachabilityCache {
+        public:
+            /**
+             * @param boards bitboards of the current state
+             * @param s current state
+             * @param id character to move
+             * @param movePoints movement budget
+             * @param passOccupied true if occupied fields can be entered (characters swap places when moving onto
+             * an occupied field), false to only pass free fields
+             * @return reachable fields, nullptr if character is not on the map
+             */
+            std::shared_ptr<const Reachability> get(const Bitboards &boards, const spy::gameplay::State &s,
+                                                    const spy::util::UUID &id, unsigned int movePoints,
+                                                    bool passOccupied = true);
+
+            /**
+             * forgets all results (state changed)
+             */
+            void clear();
+
+            /**
+             * @return approximate heap memory of the cache in bytes
+             */
+            [[nodiscard]] std::size_t getSizeInBytes() const;
+
+        private:
+            std::map<std::tuple<spy::util::UUID, unsigned int, bool>, std::shared_ptr<const Reachability>> cache;
+
+            [[nodiscard]] static std::shared_ptr<const Reachability>
+            compute(const Bitboards &boards, const spy::gameplay::State &s, const spy::util::UUID &id,
+                    unsigned int movePoints, bool passOccupied);
+    };
+}
+
+#endif //LIBCLIENT_REACHABILITY_HPP
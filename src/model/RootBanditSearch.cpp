@@ -0,0 +1,204 @@
+/**
+ * @file   RootBanditSearch.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the parallel time budgeted UCB1 bandit over the legal operations (no tree).
+ */
+
+#include "RootBanditSearch.hpp"
+#include <algorithm>
+#include <cmath>
+#include <util/TimeUtils.hpp>
+
+namespace libclient::model {
+
+    RootBanditSearch::RootBanditSearch(Evaluator eval, std::size_t numberOfThreads, std::uint64_t randomSeed)
+            : evaluator(std::move(eval)), pool(numberOfThreads), sampler(256, 1, randomSeed), seed(randomSeed) {}
+
+    void RootBanditSearch::setExploration(double c) {
+        exploration = c;
+    }
+
+    void RootBanditSearch::setBudget(double fraction, std::chrono::milliseconds fallback) {
+        budgetFraction = fraction;
+        fallbackBudget = fallback;
+    }
+
+    void RootBanditSearch::setTranspositionTableSize(std::size_t bytes) {
+        if (bytes == 0) {
+            table.reset();
+        } else if (table == nullptr) {
+            table = std::make_unique<TranspositionTable>(bytes);
+        } else {
+            table->resize(bytes);
+        }
+    }
+
+    const TranspositionTable *RootBanditSearch::getTranspositionTable() const {
+        return table.get();
+    }
+
+    std::chrono::milliseconds RootBanditSearch::getBudget(const spy::MatchConfig &config) const {
+        auto limit = util::getTurnPhaseLimit(config);
+        if (!limit.has_value()) {
+            return fallbackBudget;
+        }
+        return std::chrono::milliseconds(static_cast<long>(static_cast<double>(limit->count()) * budgetFraction));
+    }
+
+    SearchResult RootBanditSearch::search(const std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> &operations,
+                                       const spy::gameplay::State &s, const AIState &ai,
+                                       const spy::MatchConfig &config, spy::character::FactionEnum me,
+                                       std::chrono::steady_clock::time_point deadline) {
+        SearchResult result;
+        const auto n = operations.size();
+        result.visits.assign(n, 0);
+        result.values.assign(n, 0);
+        if (n == 0) {
+            return result;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        auto stealsBefore = pool.getNumberOfSteals();
+
+        // every search draws other random numbers than the ones before
+        const auto searchSeed = ZobristKeys::mix(seed ^ ZobristKeys::mix(++searches));
+
+        // determinizations of the hidden state, particles of the last search are reweighted with the new beliefs
+        std::vector<Determinization> worlds;
+        std::vector<double> cumulative;
+        if (sampler.update(ai)) {
+            double sum = 0;
+            for (const auto &p: sampler.getParticles()) {
+                worlds.push_back(p.world);
+                sum += p.weight;
+                cumulative.push_back(sum);
+            }
+        }
+        if (worlds.empty()) {
+            worlds.emplace_back();
+            cumulative.push_back(1);
+        }
+        std::vector<std::uint64_t> worldHashes;
+        worldHashes.reserve(worlds.size());
+        for (const auto &world: worlds) {
+            worldHashes.push_back(hashWorld(world));
+        }
+        // same keys for all workers, so their hashes can share the transposition table
+        auto keys = std::make_shared<const ZobristKeys>(s);
+        auto hitsBefore = table != nullptr ? table->getStatistics().hits : 0;
+        if (table != nullptr) {
+            table->newGeneration();
+        }
+
+        struct Worker {
+            std::vector<std::size_t> visits;
+            std::vector<double> sums;
+            std::size_t iterations = 0;
+        };
+        const auto threads = pool.getNumberOfThreads();
+        std::vector<Worker> workers(threads, Worker{std::vector<std::size_t>(n, 0), std::vector<double>(n, 0), 0});
+
+        std::vector<std::future<void>> futures;
+        for (std::size_t w = 0; w < threads; w++) {
+            futures.push_back(pool.submit([&, w]() {
+                auto &worker = workers[w];
+                Simulator simulator(s, ai, config, me, keys);
+                std::mt19937_64 rng(ZobristKeys::mix(searchSeed + w));
+                std::uniform_real_distribution<double> uniform(0, cumulative.back());
+
+                while (std::chrono::steady_clock::now() < deadline) {
+                    // UCB1, unvisited operations first
+                    std::size_t chosen = 0;
+                    double bestScore = -1;
+                    auto logTotal = std::log(static_cast<double>(worker.iterations + 1));
+                    for (std::size_t i = 0; i < n; i++) {
+                        if (worker.visits[i] == 0) {
+                            chosen = i;
+                            break;
+                        }
+                        auto visits = static_cast<double>(worker.visits[i]);
+                        auto score = worker.sums[i] / visits + exploration * std::sqrt(logTotal / visits);
+                        if (score > bestScore) {
+                            bestScore = score;
+                            chosen = i;
+                        }
+                    }
+
+                    auto drawn = std::lower_bound(cumulative.begin(), cumulative.end(), uniform(rng)) -
+                                 cumulative.begin();
+                    auto world = std::min(static_cast<std::size_t>(drawn), worlds.size() - 1);
+                    double value = 0;
+                    simulator.determinize(worlds[world], sampler);
+                    if (simulator.apply(operations[chosen])) {
+                        auto hash = simulator.getHash() ^ worldHashes[world];
+                        auto cached = table != nullptr ? table->probe(hash) : std::nullopt;
+                        if (cached.has_value()) {
+                            value = cached->value;
+                        } else {
+                            value = evaluator(simulator, worlds[world]);
+                            if (table != nullptr) {
+                                table->store(hash, {static_cast<float>(value), 0, 0});
+                            }
+                        }
+                        simulator.undo();
+                    }
+                    simulator.undo();
+                    worker.visits[chosen]++;
+                    worker.sums[chosen] += value;
+                    worker.iterations++;
+                }
+            }));
+        }
+        for (auto &future: futures) {
+            pool.wait(future);
+            future.get();
+        }
+
+        // merge root statistics of all workers
+        std::size_t iterations = 0;
+        std::vector<double> sums(n, 0);
+        for (const auto &worker: workers) {
+            iterations += worker.iterations;
+            for (std::size_t i = 0; i < n; i++) {
+                result.visits[i] += worker.visits[i];
+                sums[i] += worker.sums[i];
+            }
+        }
+        std::size_t best = 0;
+        for (std::size_t i = 0; i < n; i++) {
+            result.values[i] = result.visits[i] > 0 ? sums[i] / static_cast<double>(result.visits[i]) : 0;
+            if (result.visits[i] > result.visits[best] ||
+                (result.visits[i] == result.visits[best] && result.values[i] > result.values[best])) {
+                best = i;
+            }
+        }
+        result.best = operations[best];
+
+        std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+        statistics.iterations = iterations;
+        statistics.seconds = duration.count();
+        statistics.threads = threads;
+        statistics.steals = pool.getNumberOfSteals() - stealsBefore;
+        statistics.tableHits = table != nullptr ? table->getStatistics().hits - hitsBefore : 0;
+        statistics.iterationsPerSecond = statistics.seconds > 0 ? static_cast<double>(iterations) / statistics.seconds
+                                                                : 0;
+        statistics.iterationsPerSecondPerThread = statistics.iterationsPerSecond / static_cast<double>(threads);
+        return result;
+    }
+
+    const SearchStatistics &RootBanditSearch::getStatistics() const {
+        return statistics;
+    }
+
+    std::uint64_t RootBanditSearch::hashWorld(const Determinization &world) {
+        std::uint64_t hash = 0;
+        for (std::size_t c = 0; c < world.factions.size(); c++) {
+            hash = ZobristKeys::mix(hash ^ (c << 8U) ^ static_cast<std::uint64_t>(world.factions[c]));
+        }
+        for (std::size_t g = 0; g < world.gadgetOwners.size(); g++) {
+            hash = ZobristKeys::mix(hash ^ (g << 32U) ^ world.gadgetOwners[g]);
+        }
+        return hash;
+    }
+}
@@ -0,0 +1,135 @@
+/**
+ * @file   RootBanditSearch.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the parallel time budgeted UCB1 bandit over the legal operations (no tree).
+ */
+
+#ifndef LIBCLIENT_ROOTBANDITSEARCH_HPP
+#define LIBCLIENT_ROOTBANDITSEARCH_HPP
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+#include <datatypes/gameplay/BaseOperation.hpp>
+#include <model/BeliefSampler.hpp>
+#include <model/Simulator.hpp>
+#include <model/TranspositionTable.hpp>
+#include <util/ThreadPool.hpp>
+
+namespace libclient::model {
+
+    struct SearchResult {
+        std::shared_ptr<spy::gameplay::BaseOperation> best; // most visited operation, nullptr if there was none
+        std::vector<std::size_t> visits; // per operation
+        std::vector<double> values; // mean value per operation
+    };
+
+    /**
+     * throughput and scaling of the last search
+     */
+    struct SearchStatistics {
+        std::size_t iterations = 0;
+        double seconds = 0;
+        std::size_t threads = 0;
+        std::size_t steals = 0; // tasks stolen between workers during the search
+        std::size_t tableHits = 0; // evaluations taken from the transposition table
+        double iterationsPerSecond = 0;
+        double iterationsPerSecondPerThread = 0; // constant for perfect scaling
+    };
+
+    /**
+     * flat monte carlo bandit at the root, this is not a tree search: every iteration chooses one legal operation of
+     * the active character by UCB1, applies it, lets the evaluator judge the resulting position and undoes it
+     * there is no expansion below the root, move generation only exists for the live state (OperationGenerator needs
+     * the caches of GameState), not for Simulator::getState()
+     * every worker of a work stealing pool runs its own bandit with its own simulator, hidden information (factions,
+     * gadget owners) is drawn from a particle population per iteration and assumed in the simulator before the
+     * operation is applied, statistics of all workers are merged when the budget is used up
+     * the particle population is kept between searches and reweighted with the beliefs of every search
+     */
+    class RootBanditSearch {
+        public:
+            /**
+             * called by all worker threads at the same time (each with its own simulator and determinization), so it
+             * has to be thread safe: no unsynchronized shared mutable state, and it must not read the live model
+             * (LibClient, Network) which is written by the network thread
+             * @return value of position in [0, 1] from my point of view
+             */
+            using Evaluator = std::function<double(const Simulator &simulator, const Determinization &world)>;
+
+            /**
+             * @param evaluator evaluation of positions after an operation, called concurrently by all workers
+             * @param numberOfThreads number of workers, 0 uses all cores
+             * @param seed seed of the random number generators (mixed with the number of the search)
+             */
+            explicit RootBanditSearch(Evaluator evaluator, std::size_t numberOfThreads = 0,
+                                   std::uint64_t seed = std::random_device{}());
+
+            /**
+             * @param c exploration constant of UCB1 (default sqrt(2))
+             */
+            void setExploration(double c);
+
+            /**
+             * @param fraction part of the turn phase limit of the match config used by getBudget (default 0.5)
+             * @param fallback budget if match config has no turn phase limit (default 1 s)
+             */
+            void setBudget(double fraction, std::chrono::milliseconds fallback);
+
+            /**
+             * caches evaluations by zobrist hash of the position and the determinization in a transposition table
+             * shared by all workers (kept between searches), only useful for deterministic evaluators
+             * @param bytes memory of the table, 0 disables caching (default)
+             */
+            void setTranspositionTableSize(std::size_t bytes);
+
+            /**
+             * @return transposition table, nullptr if caching is disabled
+             */
+            [[nodiscard]] const TranspositionTable *getTranspositionTable() const;
+
+            /**
+             * @param config match config
+             * @return wall clock budget for one search derived from the turn phase limit
+             */
+            [[nodiscard]] std::chrono::milliseconds getBudget(const spy::MatchConfig &config) const;
+
+            /**
+             * searches until deadline and returns best operation found so far
+             * @param operations legal operations of the active character
+             * @param s current state
+             * @param ai current beliefs (not changed)
+             * @param config match config
+             * @param me my faction
+             * @param deadline point in time the result is needed
+             * @return result, best is nullptr if operations is empty
+             */
+            SearchResult search(const std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> &operations,
+                                const spy::gameplay::State &s, const AIState &ai, const spy::MatchConfig &config,
+                                spy::character::FactionEnum me, std::chrono::steady_clock::time_point deadline);
+
+            [[nodiscard]] const SearchStatistics &getStatistics() const;
+
+        private:
+            Evaluator evaluator;
+            util::ThreadPool pool;
+            BeliefSampler sampler;
+            std::uint64_t seed;
+            std::uint64_t searches = 0; // number of calls of search
+            double exploration = 1.4142135623730951;
+            double budgetFraction = 0.5;
+            std::chrono::milliseconds fallbackBudget{1000};
+            std::unique_ptr<TranspositionTable> table;
+            SearchStatistics statistics;
+
+            /**
+             * @return hash of the hidden information of a determinization
+             */
+            [[nodiscard]] static std::uint64_t hashWorld(const Determinization &world);
+    };
+}
+
+#endif //LIBCLIENT_ROOTBANDITSEARCH_HPP
@@ -0,0 +1,160 @@
+/**
+ * @file   SafePlanner.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the planner ranking safes to open and npcs to spy on.
+ */
+
+#include "SafePlanner.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <tuple>
+
+namespace libclient::model {
+
+    bool SafePlanner::Key::operator==(const Key &other) const {
+        return numberOfCombinations == other.numberOfCombinations && openedByMe == other.openedByMe &&
+               triedSafes == other.triedSafes && positions == other.positions && npcs == other.npcs;
+    }
+
+    SafePlanner::SafePlanner() : distance([](const spy::util::Point &from, const spy::util::Point &target) {
+        auto steps = static_cast<unsigned int>(std::max(std::abs(from.x - target.x), std::abs(from.y - target.y)));
+        return std::optional<unsigned int>(steps > 0 ? steps - 1 : 0);
+    }) {}
+
+    void SafePlanner::setDistanceFunction(DistanceFunction function) {
+        distance = std::move(function);
+        invalidate();
+    }
+
+    const SafePlan &SafePlanner::plan(const AIState &ai, const spy::gameplay::State &s,
+                                      const spy::MatchConfig &config) {
+        auto key = makeKey(ai, s);
+        if (!cachedKey.has_value() || !(cachedKey.value() == key)) {
+            cachedPlan = compute(ai, key, config);
+            cachedKey = std::move(key);
+        }
+        return cachedPlan;
+    }
+
+    void SafePlanner::invalidate() {
+        cachedKey.reset();
+    }
+
+    SafePlanner::Key SafePlanner::makeKey(const AIState &ai, const spy::gameplay::State &s) {
+        Key key;
+        key.numberOfCombinations = ai.safeCombinations.size();
+        key.openedByMe = ai.safes.getOpenedByMe().getWords();
+        key.triedSafes = ai.triedSafes;
+        for (const auto &c: s.getCharacters()) {
+            bool relevant = ai.myFaction.find(c.getCharacterId()) != ai.myFaction.end() ||
+                            ai.npcFaction.find(c.getCharacterId()) != ai.npcFaction.end();
+            if (relevant && c.getCoordinates().has_value()) {
+                key.positions.emplace_back(c.getCharacterId(), c.getCoordinates().value());
+            }
+        }
+        for (const auto &npc: ai.npcFaction) {
+            if (ai.combinationsFromNpcs.find(npc) == ai.combinationsFromNpcs.end()) {
+                key.npcs.insert(npc);
+            }
+        }
+        return key;
+    }
+
+    SafePlan SafePlanner::compute(const AIState &ai, const Key &key, const spy::MatchConfig &config) const {
+        SafePlan result;
+        const auto &registry = ai.safes;
+        const auto numberOfSafes = registry.getNumberOfSafes();
+
+        auto closest = [this, &ai, &key](const spy::util::Point &target)
+                -> std::pair<std::optional<unsigned int>, std::optional<spy::util::UUID>> {
+            std::optional<unsigned int> best;
+            std::optional<spy::util::UUID> bestCharacter;
+            for (const auto &[id, position]: key.positions) {
+                if (ai.myFaction.find(id) == ai.myFaction.end()) {
+                    continue;
+                }
+                auto d = distance(position, target);
+                if (d.has_value() && (!best.has_value() || d.value() < best.value())) {
+                    best = d;
+                    bestCharacter = id;
+                }
+            }
+            return {best, bestCharacter};
+        };
+
+        for (unsigned int index = 0; index < numberOfSafes; index++) {
+            if (!registry.isOpenable(index)) {
+                continue;
+            }
+            auto tried = key.triedSafes.find(index);
+            auto combinationsWhenTried = tried == key.triedSafes.end() ? std::nullopt
+                                                                       : std::optional<int>(tried->second);
+            auto chance = successChance(key.numberOfCombinations, numberOfSafes, combinationsWhenTried);
+            result.combinationValue += successChance(key.numberOfCombinations + 1, numberOfSafes,
+                                                     combinationsWhenTried) - chance;
+            if (chance <= 0) {
+                continue;
+            }
+
+            SafeTarget target;
+            target.index = index;
+            target.position = registry.getPosition(index);
+            target.successChance = chance;
+            std::tie(target.distance, target.closestCharacter) = closest(target.position);
+            if (!target.distance.has_value()) {
+                // no own character can reach the safe
+                continue;
+            }
+            target.score = chance / (1 + static_cast<double>(target.distance.value()));
+            result.safes.push_back(target);
+        }
+
+        std::sort(result.safes.begin(), result.safes.end(), [](const SafeTarget &a, const SafeTarget &b) {
+            return a.score > b.score;
+        });
+
+        for (const auto &npc: key.npcs) {
+            NpcSpyTarget target;
+            target.npc = npc;
+            target.expectedGain = config.getSpySuccessChance() * result.combinationValue;
+            auto position = std::find_if(key.positions.begin(), key.positions.end(),
+                                         [&npc](const std::pair<spy::util::UUID, spy::util::Point> &p) {
+                                             return p.first == npc;
+                                         });
+            if (position != key.positions.end()) {
+                target.distance = closest(position->second).first;
+            }
+            result.npcs.push_back(target);
+        }
+
+        std::sort(result.npcs.begin(), result.npcs.end(), [](const NpcSpyTarget &a, const NpcSpyTarget &b) {
+            if (a.expectedGain != b.expectedGain) {
+                return a.expectedGain > b.expectedGain;
+            }
+            return a.distance.value_or(std::numeric_limits<unsigned int>::max()) <
+                   b.distance.value_or(std::numeric_limits<unsigned int>::max());
+        });
+
+        return result;
+    }
+
+    double SafePlanner::successChance(std::size_t combinations, std::size_t safes,
+                                      std::optional<int> combinationsWhenTried) {
+        if (safes == 0) {
+            return 0;
+        }
+        combinations = std::min(combinations, safes);
+        if (!combinationsWhenTried.has_value()) {
+            return static_cast<double>(combinations) / static_cast<double>(safes);
+        }
+
+        auto before = static_cast<std::size_t>(std::max(combinationsWhenTried.value(), 0));
+        if (combinations <= before || before >= safes) {
+            // no new combination since last try
+            return 0;
+        }
+        return static_cast<double>(combinations - before) / static_cast<double>(safes - before);
+    }
+}
@@ -0,0 +1,107 @@
+/**
+ * @file   SafePlanner.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the planner ranking safes to open and npcs to spy on.
+ */
+
+#ifndef LIBCLIENT_SAFEPLANNER_HPP
+#define LIBCLIENT_SAFEPLANNER_HPP
+
+#include <functional>
+#include <model/AIState.hpp>
+
+namespace libclient::model {
+
+    /**
+     * safe worth trying to open
+     */
+    struct SafeTarget {
+        unsigned int index = 0; // index in safe registry
+        spy::util::Point position;
+        double successChance = 0; // estimated chance that a known combination opens the safe
+        std::optional<unsigned int> distance; // steps of closest own character to a field next to the safe
+        std::optional<spy::util::UUID> closestCharacter;
+        double score = 0; // successChance / (1 + distance), higher is better
+    };
+
+    /**
+     * npc that may reveal new safe combinations when being spied on
+     */
+    struct NpcSpyTarget {
+        spy::util::UUID npc;
+        double expectedGain = 0; // expected increase of the summed success chance of all openable safes
+        std::optional<unsigned int> distance; // steps of closest own character to a field next to the npc
+    };
+
+    struct SafePlan {
+        std::vector<SafeTarget> safes; // best first, safes without success chance or own character reaching them are omitted
+        std::vector<NpcSpyTarget> npcs; // best first
+        double combinationValue = 0; // increase of summed success chance by one more known combination
+    };
+
+    /**
+     * ranks safes using known combinations, tried safes and positions of own characters
+     * the plan is cached and only recomputed if combinations, opened or tried safes or positions changed
+     *
+     * success chance heuristic (k safes, c known combinations):
+     *  - safe never tried: c / k
+     *  - safe tried with c' combinations: (c - c') / (k - c'), 0 if no combination was learned since
+     */
+    class SafePlanner {
+        public:
+            /**
+             * steps needed to get from a position to a field next to the target, nullopt if not reachable
+             */
+            using DistanceFunction = std::function<std::optional<unsigned int>(const spy::util::Point &from,
+                                                                               const spy::util::Point &target)>;
+
+            SafePlanner();
+
+            /**
+             * replaces distance estimation (default: chebyshev distance minus one)
+             * @param function distance function, invalidates cached plan
+             */
+            void setDistanceFunction(DistanceFunction function);
+
+            /**
+             * @param ai current AIState (safe registry has to be built)
+             * @param s current state
+             * @param config match config
+             * @return plan, cached if nothing relevant changed since last call
+             */
+            const SafePlan &plan(const AIState &ai, const spy::gameplay::State &s, const spy::MatchConfig &config);
+
+            /**
+             * forces recomputation on next call of plan
+             */
+            void invalidate();
+
+        private:
+            /**
+             * everything the plan depends on
+             */
+            struct Key {
+                std::size_t numberOfCombinations = 0;
+                std::vector<std::uint64_t> openedByMe;
+                std::map<unsigned int, int> triedSafes;
+                std::vector<std::pair<spy::util::UUID, spy::util::Point>> positions;
+                std::set<spy::util::UUID> npcs;
+
+                bool operator==(const Key &other) const;
+            };
+
+            DistanceFunction distance;
+            std::optional<Key> cachedKey;
+            SafePlan cachedPlan;
+
+            [[nodiscard]] static Key makeKey(const AIState &ai, const spy::gameplay::State &s);
+
+            [[nodiscard]] SafePlan compute(const AIState &ai, const Key &key, const spy::MatchConfig &config) const;
+
+            [[nodiscard]] static double successChance(std::size_t combinations, std::size_t safes,
+                                                      std::optional<int> combinationsWhenTried);
+    };
+}
+
+#endif //LIBCLIENT_SAFEPLANNER_HPP
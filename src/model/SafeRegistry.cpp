@@ -0,0 +1,99 @@
+/**
+ * @file   SafeRegistry.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the registry mapping safes of the level to dense indices.
+ */
+
+#include "SafeRegistry.hpp"
+#include <util/MemoryUtils.hpp>
+
+namespace libclient::model {
+
+    void SafeRegistry::build(const spy::scenario::Scenario &level) {
+        build(level.getScenario(), [](spy::scenario::FieldStateEnum state) {
+            return state == spy::scenario::FieldStateEnum::SAFE;
+        });
+    }
+
+    void SafeRegistry::build(const spy::scenario::FieldMap &map) {
+        build(map.getMap(), [](const spy::scenario::Field &field) {
+            return field.getFieldState() == spy::scenario::FieldStateEnum::SAFE;
+        });
+    }
+
+    template<typename Rows, typename IsSafe>
+    void SafeRegistry::build(const Rows &rows, IsSafe isSafe) {
+        indexer = util::FieldIndexer(rows);
+        positions.clear();
+        fieldToIndex.assign(indexer.getNumberOfFields(), noSafe);
+        for (auto y = 0U; y < rows.size(); y++) {
+            for (auto x = 0U; x < rows[y].size(); x++) {
+                if (isSafe(rows[y][x])) {
+                    fieldToIndex[indexer.getIndex(x, y)] = static_cast<unsigned int>(positions.size());
+                    positions.push_back(spy::util::Point{static_cast<int>(x), static_cast<int>(y)});
+                }
+            }
+        }
+
+        openedByMe = util::Bitset(positions.size());
+        openedTotal = util::Bitset(positions.size());
+        built = true;
+    }
+
+    bool SafeRegistry::isBuilt() const {
+        return built;
+    }
+
+    std::size_t SafeRegistry::getNumberOfSafes() const {
+        return positions.size();
+    }
+
+    std::optional<unsigned int> SafeRegistry::getIndex(const spy::util::Point &p) const {
+        auto field = indexer.getIndex(p);
+        if (!field.has_value() || fieldToIndex[field.value()] == noSafe) {
+            return std::nullopt;
+        }
+        return fieldToIndex[field.value()];
+    }
+
+    const spy::util::Point &SafeRegistry::getPosition(unsigned int index) const {
+        return positions.at(index);
+    }
+
+    const std::vector<spy::util::Point> &SafeRegistry::getPositions() const {
+        return positions;
+    }
+
+    void SafeRegistry::markOpened(unsigned int index, bool byMe) {
+        openedTotal.set(index);
+        if (byMe) {
+            openedByMe.set(index);
+        }
+    }
+
+    const util::Bitset &SafeRegistry::getOpenedByMe() const {
+        return openedByMe;
+    }
+
+    const util::Bitset &SafeRegistry::getOpenedTotal() const {
+        return openedTotal;
+    }
+
+    bool SafeRegistry::isOpened(unsigned int index) const {
+        return openedTotal.test(index);
+    }
+
+    std::size_t SafeRegistry::getNumberOfOpenableSafes() const {
+        return positions.size() - openedByMe.count();
+    }
+
+    bool SafeRegistry::isOpenable(unsigned int index) const {
+        return index < positions.size() && !openedByMe.test(index);
+    }
+
+    std::size_t SafeRegistry::getSizeInBytes() const {
+        return util::capacityInBytes(positions) + util::capacityInBytes(fieldToIndex) +
+               util::capacityInBytes(openedByMe.getWords()) + util::capacityInBytes(openedTotal.getWords());
+    }
+}
@@ -0,0 +1,111 @@
+/**
+ * @file   SafeRegistry.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the registry mapping safes of the level to dense indices.
+ */
+
+#ifndef LIBCLIENT_SAFEREGISTRY_HPP
+#define LIBCLIENT_SAFEREGISTRY_HPP
+
+#include <limits>
+#include <optional>
+#include <vector>
+#include <datatypes/scenario/Scenario.hpp>
+#include <datatypes/gameplay/State.hpp>
+#include <util/Point.hpp>
+#include <util/Bitset.hpp>
+#include <util/FieldIndexer.hpp>
+
+namespace libclient::model {
+
+    /**
+     * maps each safe of the level to an index 0..k-1 (row major order) and keeps track of opened safes as bitsets
+     */
+    class SafeRegistry {
+        public:
+            /**
+             * collects safes of level
+             * @param level scenario of the match
+             */
+            void build(const spy::scenario::Scenario &level);
+
+            /**
+             * collects safes of the map of a state (if level is unknown, e.g. configs were set by client)
+             * @param map map of a state of the match
+             */
+            void build(const spy::scenario::FieldMap &map);
+
+            [[nodiscard]] bool isBuilt() const;
+
+            [[nodiscard]] std::size_t getNumberOfSafes() const;
+
+            /**
+             * @param p position of the safe
+             * @return index of the safe, nullopt if there is no safe at p
+             */
+            [[nodiscard]] std::optional<unsigned int> getIndex(const spy::util::Point &p) const;
+
+            /**
+             * @param index index of the safe
+             * @return position of the safe
+             */
+            [[nodiscard]] const spy::util::Point &getPosition(unsigned int index) const;
+
+            [[nodiscard]] const std::vector<spy::util::Point> &getPositions() const;
+
+            /**
+             * marks safe as opened
+             * @param index index of the safe
+             * @param byMe true if safe was opened by a character of my faction
+             */
+            void markOpened(unsigned int index, bool byMe);
+
+            /**
+             * @return safes opened by my faction
+             */
+            [[nodiscard]] const util::Bitset &getOpenedByMe() const;
+
+            /**
+             * @return safes opened by anyone
+             */
+            [[nodiscard]] const util::Bitset &getOpenedTotal() const;
+
+            [[nodiscard]] bool isOpened(unsigned int index) const;
+
+            /**
+             * @return number of safes not yet opened by my faction
+             */
+            [[nodiscard]] std::size_t getNumberOfOpenableSafes() const;
+
+            /**
+             * @param index index of the safe
+             * @return true if safe was not yet opened by my faction
+             */
+            [[nodiscard]] bool isOpenable(unsigned int index) const;
+
+            /**
+             * @return approximate heap memory of the registry in bytes
+             */
+            [[nodiscard]] std::size_t getSizeInBytes() const;
+
+        private:
+            std::vector<spy::util::Point> positions;
+            std::vector<unsigned int> fieldToIndex; // row major, noSafe for fields without safe
+            util::FieldIndexer indexer;
+            util::Bitset openedByMe;
+            util::Bitset openedTotal;
+            bool built = false;
+
+            static constexpr unsigned int noSafe = std::numeric_limits<unsigned int>::max();
+
+            /**
+             * @param rows rows of the level or map
+             * @param isSafe returns true if an element of a row is a safe
+             */
+            template<typename Rows, typename IsSafe>
+            void build(const Rows &rows, IsSafe isSafe);
+    };
+}
+
+#endif //LIBCLIENT_SAFEREGISTRY_HPP
@@ -0,0 +1,251 @@
+/**
+ * @file   Simulator.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the forward simulation of hypothetical operations with undo.
+ */
+
+#include "Simulator.hpp"
+#include <algorithm>
+#include <chrono>
+#include <util/GadgetKeys.hpp>
+#include <util/GameLogicUtils.hpp>
+#include <util/OperationDispatch.hpp>
+
+namespace libclient::model {
+
+    double SimulationStatistics::getNodesPerSecond() const {
+        return seconds > 0 ? static_cast<double>(nodes) / seconds : 0;
+    }
+
+    double SimulationComparison::getSpeedup() const {
+        return copyNodesPerSecond > 0 ? undoNodesPerSecond / copyNodesPerSecond : 0;
+    }
+
+    Simulator::Simulator(const spy::gameplay::State &s, const AIState &ai, spy::MatchConfig matchConfig,
+                         spy::character::FactionEnum myFaction, std::shared_ptr<const ZobristKeys> zobristKeys)
+            : state(s), beliefs(ai.fork()), config(std::move(matchConfig)), me(myFaction),
+              keys(zobristKeys != nullptr ? std::move(zobristKeys) : std::make_shared<const ZobristKeys>(s)),
+              stateHash(keys->hashState(state)), beliefHash(keys->hashBeliefs(beliefs)) {}
+
+    bool Simulator::apply(const std::shared_ptr<const spy::gameplay::BaseOperation> &operation) {
+        using spy::gameplay::OperationEnum;
+
+        auto op = util::asCharacterOperation(*operation);
+        if (op == nullptr) {
+            return false;
+        }
+        auto character = state.getCharacters().getByUUID(op->getCharacterId());
+        if (character == state.getCharacters().end() || !character->getCoordinates().has_value()) {
+            return false;
+        }
+
+        Undo undo;
+        undo.character = op->getCharacterId();
+        undo.position = character->getCoordinates();
+        undo.movePoints = character->getMovePoints();
+        undo.actionPoints = character->getActionPoints();
+        undo.stateHash = stateHash;
+        undo.beliefHash = beliefHash;
+        auto index = keys->getCharacterIndex(undo.character);
+
+        // beliefs are updated with the state before the operation, the checkpoint only marks the undo log
+        beliefs.checkpoint();
+        beliefs.processOperation(*operation, state, config, me);
+
+        switch (operation->getType()) {
+            case OperationEnum::MOVEMENT: {
+                auto target = operation->getTarget();
+                auto other = spy::util::GameLogicUtils::findInCharacterSetByCoordinates(state.getCharacters(),
+                                                                                       target);
+                if (other != state.getCharacters().end()) {
+                    // moving onto an occupied field swaps places
+                    undo.swapped = std::make_pair(other->getCharacterId(), target);
+                    state.getCharacters().getByUUID(other->getCharacterId())->setCoordinates(undo.position.value());
+                    auto otherIndex = keys->getCharacterIndex(other->getCharacterId());
+                    if (otherIndex.has_value()) {
+                        stateHash ^= keys->position(otherIndex.value(), target) ^
+                                     keys->position(otherIndex.value(), undo.position);
+                    }
+                }
+                character->setCoordinates(target);
+                character->setMovePoints(undo.movePoints > 0 ? undo.movePoints - 1 : 0);
+                break;
+            }
+            case OperationEnum::RETIRE:
+                character->setMovePoints(0);
+                character->setActionPoints(0);
+                break;
+            default:
+                character->setActionPoints(undo.actionPoints > 0 ? undo.actionPoints - 1 : 0);
+                break;
+        }
+
+        if (index.has_value()) {
+            auto i = index.value();
+            stateHash ^= keys->position(i, undo.position) ^ keys->position(i, character->getCoordinates());
+            stateHash ^= keys->points(i, ZobristPoints::MOVE_POINTS, undo.movePoints) ^
+                         keys->points(i, ZobristPoints::MOVE_POINTS, character->getMovePoints());
+            stateHash ^= keys->points(i, ZobristPoints::ACTION_POINTS, undo.actionPoints) ^
+                         keys->points(i, ZobristPoints::ACTION_POINTS, character->getActionPoints());
+        }
+        if (beliefs.changedSinceCheckpoint()) {
+            // not incremental, see class doc
+            beliefHash = keys->hashBeliefs(beliefs);
+        }
+
+        undos.push_back(std::move(undo));
+        return true;
+    }
+
+    void Simulator::determinize(const Determinization &world, const BeliefSampler &sampler) {
+        using spy::character::FactionEnum;
+
+        Undo undo;
+        undo.determinization = true;
+        undo.stateHash = stateHash;
+        undo.beliefHash = beliefHash;
+        beliefs.checkpoint();
+
+        const auto &characters = sampler.getCharacters();
+        for (std::size_t c = 0; c < std::min(characters.size(), world.factions.size()); c++) {
+            if (beliefs.unknownFaction.find(characters[c]) == beliefs.unknownFaction.end()) {
+                continue;
+            }
+            switch (world.factions[c]) {
+                case FactionEnum::PLAYER1:
+                    beliefs.addFaction(characters[c], beliefs.myFaction);
+                    break;
+                case FactionEnum::PLAYER2:
+                    beliefs.addFaction(characters[c], beliefs.enemyFaction);
+                    break;
+                case FactionEnum::NEUTRAL:
+                    beliefs.addFaction(characters[c], beliefs.npcFaction);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        const auto &ownership = sampler.getGadgetOwnership();
+        const auto &owners = ownership.getCharacters();
+        for (std::size_t g = 0; g < world.gadgetOwners.size(); g++) {
+            auto type = spy::gadget::GadgetEnum(g + 1);
+            auto owner = world.gadgetOwners[g];
+            bool unknown = beliefs.unknownGadgets.find(util::GadgetKeys::get(type)) != beliefs.unknownGadgets.end();
+            if (!unknown || owner == Determinization::noOwner || owner == ownership.getUnassignedColumn()) {
+                continue;
+            }
+            if (owner == ownership.getFloorColumn()) {
+                beliefs.addGadget(type, std::nullopt);
+            } else if (owner < owners.size()) {
+                beliefs.addGadget(type, owners[owner]);
+            }
+        }
+
+        if (beliefs.changedSinceCheckpoint()) {
+            beliefHash = keys->hashBeliefs(beliefs);
+        }
+        undos.push_back(std::move(undo));
+    }
+
+    bool Simulator::undo() {
+        if (undos.empty()) {
+            return false;
+        }
+        const auto &undo = undos.back();
+
+        if (!undo.determinization) {
+            auto character = state.getCharacters().getByUUID(undo.character);
+            if (undo.position.has_value()) {
+                character->setCoordinates(undo.position.value());
+            }
+            character->setMovePoints(undo.movePoints);
+            character->setActionPoints(undo.actionPoints);
+            if (undo.swapped.has_value()) {
+                state.getCharacters().getByUUID(undo.swapped->first)->setCoordinates(undo.swapped->second);
+            }
+        }
+
+        stateHash = undo.stateHash;
+        beliefHash = undo.beliefHash;
+        beliefs.rollback();
+        undos.pop_back();
+        return true;
+    }
+
+    std::size_t Simulator::getDepth() const {
+        return undos.size();
+    }
+
+    const spy::gameplay::State &Simulator::getState() const {
+        return state;
+    }
+
+    const AIState &Simulator::getAIState() const {
+        return beliefs;
+    }
+
+    std::uint64_t Simulator::getHash() const {
+        return stateHash ^ beliefHash;
+    }
+
+    const std::shared_ptr<const ZobristKeys> &Simulator::getKeys() const {
+        return keys;
+    }
+
+    const SimulationStatistics &Simulator::getStatistics() const {
+        return statistics;
+    }
+
+    double Simulator::benchmark(const std::vector<std::shared_ptr<const spy::gameplay::BaseOperation>> &operations,
+                                std::size_t repetitions) {
+        std::size_t nodes = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < repetitions; r++) {
+            std::size_t applied = 0;
+            for (const auto &op: operations) {
+                applied += apply(op);
+            }
+            nodes += applied;
+            for (; applied > 0; applied--) {
+                undo();
+            }
+        }
+        std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+        statistics.nodes += nodes;
+        statistics.seconds += duration.count();
+        return duration.count() > 0 ? static_cast<double>(nodes) / duration.count() : 0;
+    }
+
+    double
+    Simulator::benchmarkCopying(const std::vector<std::shared_ptr<const spy::gameplay::BaseOperation>> &operations,
+                                std::size_t repetitions) const {
+        std::size_t nodes = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < repetitions; r++) {
+            auto nodeState = state;
+            auto nodeBeliefs = beliefs.fork();
+            for (const auto &op: operations) {
+                auto childState = nodeState;
+                auto childBeliefs = nodeBeliefs.fork();
+                childBeliefs.processOperation(*op, nodeState, config, me);
+                nodeState = std::move(childState);
+                nodeBeliefs = std::move(childBeliefs);
+                nodes++;
+            }
+        }
+        std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+        return duration.count() > 0 ? static_cast<double>(nodes) / duration.count() : 0;
+    }
+
+    SimulationComparison
+    Simulator::compare(const std::vector<std::shared_ptr<const spy::gameplay::BaseOperation>> &operations,
+                       std::size_t repetitions) {
+        SimulationComparison comparison;
+        comparison.undoNodesPerSecond = benchmark(operations, repetitions);
+        comparison.copyNodesPerSecond = benchmarkCopying(operations, repetitions);
+        return comparison;
+    }
+}
@@ -0,0 +1,165 @@
+/**
+ * @file   Simulator.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the forward simulation of hypothetical operations with undo.
+ */
+
+#ifndef LIBCLIENT_SIMULATOR_HPP
+#define LIBCLIENT_SIMULATOR_HPP
+
+#include <memory>
+#include <vector>
+#include <datatypes/gameplay/BaseOperation.hpp>
+#include <datatypes/gameplay/State.hpp>
+#include <datatypes/matchconfig/MatchConfig.hpp>
+#include <model/AIState.hpp>
+#include <model/BeliefSampler.hpp>
+#include <model/Zobrist.hpp>
+
+namespace libclient::model {
+
+    /**
+     * throughput measured by Simulator::benchmark, one node is one applied (and undone) operation
+     */
+    struct SimulationStatistics {
+        std::size_t nodes = 0;
+        double seconds = 0;
+
+        [[nodiscard]] double getNodesPerSecond() const;
+    };
+
+    /**
+     * result of Simulator::compare, apply and undo against copying state and AIState for every node
+     */
+    struct SimulationComparison {
+        double undoNodesPerSecond = 0;
+        double copyNodesPerSecond = 0;
+
+        /**
+         * @return undoNodesPerSecond / copyNodesPerSecond, 0 if the baseline was not measured
+         */
+        [[nodiscard]] double getSpeedup() const;
+    };
+
+    /**
+     * applies hypothetical operations to one private copy of the state and a fork of the AIState, every operation
+     * can be undone (state by the saved fields of the character, AIState by its undo log), so a search only copies
+     * them once instead of once per node
+     * the state is updated for movements (including swapping places), action and movement points and retire,
+     * effects of actions (gadgets, chips, health points) are only reflected in what AIState learns from them
+     * a zobrist hash of the simulated position is kept up to date, only its state part is updated incrementally:
+     * AIState facts are rehashed in full after every operation that changed them (processOperation changes them in
+     * many places and AIState does not know the keys), operations that changed nothing keep the hash
+     */
+    class Simulator {
+        public:
+            /**
+             * @param s state to start from (copied)
+             * @param ai beliefs to start from (forked, live AIState is never changed)
+             * @param config match config
+             * @param me my faction
+             * @param keys zobrist keys (shared by simulators whose hashes are compared), nullptr creates keys for s
+             */
+            Simulator(const spy::gameplay::State &s, const AIState &ai, spy::MatchConfig config,
+                      spy::character::FactionEnum me, std::shared_ptr<const ZobristKeys> keys = nullptr);
+
+            /**
+             * applies operation to state and beliefs
+             * @param operation operation of a character
+             * @return false if operation can not be simulated (executing character not on the map)
+             */
+            bool apply(const std::shared_ptr<const spy::gameplay::BaseOperation> &operation);
+
+            /**
+             * assumes the hidden information of a determinization in the beliefs: characters of unknownFaction get
+             * their faction of world, gadgets drawn for a character or the floor are moved there
+             * undone by undo like an operation (counts as one level of getDepth)
+             * @param world determinization drawn by sampler
+             * @param sampler sampler world was drawn from (order of characters and gadget columns)
+             */
+            void determinize(const Determinization &world, const BeliefSampler &sampler);
+
+            /**
+             * undoes last applied operation or determinization
+             * @return false if nothing is applied
+             */
+            bool undo();
+
+            /**
+             * @return number of applied operations that can be undone
+             */
+            [[nodiscard]] std::size_t getDepth() const;
+
+            [[nodiscard]] const spy::gameplay::State &getState() const;
+
+            [[nodiscard]] const AIState &getAIState() const;
+
+            /**
+             * @return zobrist hash of state and AIState facts, updated with every apply and undo
+             */
+            [[nodiscard]] std::uint64_t getHash() const;
+
+            [[nodiscard]] const std::shared_ptr<const ZobristKeys> &getKeys() const;
+
+            [[nodiscard]] const SimulationStatistics &getStatistics() const;
+
+            /**
+             * applies and undoes operations repeatedly to measure throughput (state is unchanged afterwards)
+             * @param operations operations applied in order before they are undone
+             * @param repetitions number of repetitions
+             * @return nodes per second
+             */
+            double benchmark(const std::vector<std::shared_ptr<const spy::gameplay::BaseOperation>> &operations,
+                             std::size_t repetitions);
+
+            /**
+             * processes the operations in order, every node on its own copy of the state and fork of the AIState of
+             * its parent (how a search without undo expands a path), the state itself is not updated -> lower bound
+             * of the cost of copying
+             * @param operations operations processed in order
+             * @param repetitions number of repetitions
+             * @return nodes per second
+             */
+            [[nodiscard]] double
+            benchmarkCopying(const std::vector<std::shared_ptr<const spy::gameplay::BaseOperation>> &operations,
+                             std::size_t repetitions) const;
+
+            /**
+             * runs benchmark and benchmarkCopying with the same operations
+             * @param operations operations applied in order
+             * @param repetitions number of repetitions of each benchmark
+             * @return nodes per second of both
+             */
+            SimulationComparison
+            compare(const std::vector<std::shared_ptr<const spy::gameplay::BaseOperation>> &operations,
+                    std::size_t repetitions);
+
+        private:
+            /**
+             * everything apply changed in state
+             */
+            struct Undo {
+                bool determinization = false; // only beliefs changed
+                spy::util::UUID character;
+                std::optional<spy::util::Point> position;
+                unsigned int movePoints = 0;
+                unsigned int actionPoints = 0;
+                std::optional<std::pair<spy::util::UUID, spy::util::Point>> swapped; // character and its old field
+                std::uint64_t stateHash = 0;
+                std::uint64_t beliefHash = 0;
+            };
+
+            spy::gameplay::State state;
+            AIState beliefs;
+            spy::MatchConfig config;
+            spy::character::FactionEnum me;
+            std::shared_ptr<const ZobristKeys> keys;
+            std::uint64_t stateHash;
+            std::uint64_t beliefHash;
+            std::vector<Undo> undos;
+            SimulationStatistics statistics;
+    };
+}
+
+#endif //LIBCLIENT_SIMULATOR_HPP
@@ -0,0 +1,152 @@
+/**
+ * @file   TranspositionTable.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the lock free transposition table shared by search threads.
+ */
+
+#include "TranspositionTable.hpp"
+#include <cstring>
+
+namespace libclient::model {
+
+    namespace {
+        std::size_t floorPowerOfTwo(std::size_t n) {
+            std::size_t p = 1;
+            while (p <= n / 2) {
+                p *= 2;
+            }
+            return p;
+        }
+    }
+
+    TranspositionTable::TranspositionTable(std::size_t bytes, std::size_t shardCount) {
+        numberOfShards = 1;
+        shardShift = 64;
+        while (numberOfShards < shardCount) {
+            numberOfShards *= 2;
+            shardShift--;
+        }
+        shards = std::make_unique<Shard[]>(numberOfShards);
+        resize(bytes);
+    }
+
+    void TranspositionTable::resize(std::size_t bytes) {
+        bucketsPerShard = floorPowerOfTwo(bytes / sizeof(Bucket) / numberOfShards);
+        for (std::size_t i = 0; i < numberOfShards; i++) {
+            shards[i].buckets = std::make_unique<Bucket[]>(bucketsPerShard);
+            shards[i].mask = bucketsPerShard - 1;
+        }
+    }
+
+    void TranspositionTable::clear() {
+        for (std::size_t i = 0; i < numberOfShards; i++) {
+            auto &shard = shards[i];
+            for (std::size_t b = 0; b < bucketsPerShard; b++) {
+                for (auto &slot: shard.buckets[b].slots) {
+                    slot.check.store(0, std::memory_order_relaxed);
+                    slot.data.store(0, std::memory_order_relaxed);
+                }
+            }
+            shard.probes = 0;
+            shard.hits = 0;
+            shard.stores = 0;
+            shard.replacements = 0;
+        }
+    }
+
+    void TranspositionTable::newGeneration() {
+        auto next = static_cast<std::uint8_t>(generation.load(std::memory_order_relaxed) + 1);
+        // generation 0 marks empty slots
+        generation.store(next == 0 ? 1 : next, std::memory_order_relaxed);
+    }
+
+    std::optional<TranspositionEntry> TranspositionTable::probe(std::uint64_t hash) const {
+        auto &shard = getShard(hash);
+        shard.probes.fetch_add(1, std::memory_order_relaxed);
+        const auto &bucket = shard.buckets[hash & shard.mask];
+        for (const auto &slot: bucket.slots) {
+            auto data = slot.data.load(std::memory_order_relaxed);
+            auto check = slot.check.load(std::memory_order_relaxed);
+            if (data != 0 && (check ^ data) == hash) {
+                shard.hits.fetch_add(1, std::memory_order_relaxed);
+                return unpack(data);
+            }
+        }
+        return std::nullopt;
+    }
+
+    void TranspositionTable::store(std::uint64_t hash, const TranspositionEntry &entry) {
+        auto &shard = getShard(hash);
+        auto &bucket = shard.buckets[hash & shard.mask];
+        auto currentGeneration = generation.load(std::memory_order_relaxed);
+
+        // same position, else lowest priority (empty < older generation < shallower)
+        Slot *target = nullptr;
+        unsigned int targetPriority = ~0U;
+        for (auto &slot: bucket.slots) {
+            auto data = slot.data.load(std::memory_order_relaxed);
+            if (data != 0 && (slot.check.load(std::memory_order_relaxed) ^ data) == hash) {
+                target = &slot;
+                targetPriority = 0;
+                break;
+            }
+            unsigned int priority = 0;
+            if (data != 0) {
+                auto old = static_cast<std::uint8_t>(data >> 56U);
+                priority = 1 + (old == currentGeneration ? 256U : 0U) + unpack(data).depth;
+            }
+            if (priority < targetPriority) {
+                target = &slot;
+                targetPriority = priority;
+            }
+        }
+
+        auto data = pack(entry, currentGeneration);
+        shard.stores.fetch_add(1, std::memory_order_relaxed);
+        if (targetPriority > 0) {
+            shard.replacements.fetch_add(1, std::memory_order_relaxed);
+        }
+        target->check.store(hash ^ data, std::memory_order_relaxed);
+        target->data.store(data, std::memory_order_relaxed);
+    }
+
+    std::size_t TranspositionTable::getSizeInBytes() const {
+        return numberOfShards * bucketsPerShard * sizeof(Bucket);
+    }
+
+    std::size_t TranspositionTable::getNumberOfEntries() const {
+        return numberOfShards * bucketsPerShard * bucketSize;
+    }
+
+    TranspositionStatistics TranspositionTable::getStatistics() const {
+        TranspositionStatistics statistics;
+        for (std::size_t i = 0; i < numberOfShards; i++) {
+            statistics.probes += shards[i].probes.load(std::memory_order_relaxed);
+            statistics.hits += shards[i].hits.load(std::memory_order_relaxed);
+            statistics.stores += shards[i].stores.load(std::memory_order_relaxed);
+            statistics.replacements += shards[i].replacements.load(std::memory_order_relaxed);
+        }
+        return statistics;
+    }
+
+    TranspositionTable::Shard &TranspositionTable::getShard(std::uint64_t hash) const {
+        return shards[shardShift < 64 ? hash >> shardShift : 0];
+    }
+
+    std::uint64_t TranspositionTable::pack(const TranspositionEntry &entry, std::uint8_t generation) {
+        std::uint32_t value;
+        std::memcpy(&value, &entry.value, sizeof(value));
+        return value | (std::uint64_t{entry.move} << 32U) | (std::uint64_t{entry.depth} << 48U) |
+               (std::uint64_t{generation} << 56U);
+    }
+
+    TranspositionEntry TranspositionTable::unpack(std::uint64_t data) {
+        TranspositionEntry entry;
+        auto value = static_cast<std::uint32_t>(data);
+        std::memcpy(&entry.value, &value, sizeof(value));
+        entry.move = static_cast<std::uint16_t>(data >> 32U);
+        entry.depth = static_cast<std::uint8_t>(data >> 48U);
+        return entry;
+    }
+}
@@ -0,0 +1,124 @@
+/**
+ * @file   TranspositionTable.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the lock free transposition table shared by search threads.
+ */
+
+#ifndef LIBCLIENT_TRANSPOSITIONTABLE_HPP
+#define LIBCLIENT_TRANSPOSITIONTABLE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace libclient::model {
+
+    /**
+     * stored result for a position (packed into 64 bit)
+     */
+    struct TranspositionEntry {
+        float value = 0;
+        std::uint16_t move = 0; // e.g. index of best operation
+        std::uint8_t depth = 0; // e.g. search depth or saturated number of visits, deeper entries are kept longer
+    };
+
+    struct TranspositionStatistics {
+        std::size_t probes = 0;
+        std::size_t hits = 0;
+        std::size_t stores = 0;
+        std::size_t replacements = 0; // stores that overwrote an entry of another position
+    };
+
+    /**
+     * hash table from zobrist hash to TranspositionEntry, split into shards (chosen by the upper bits of the hash)
+     * with buckets of four entries (one cache line)
+     * probe and store are lock free and can be called from any number of threads, every slot stores
+     * hash ^ data next to data, so torn writes of concurrent stores are detected as misses
+     */
+    class TranspositionTable {
+        public:
+            /**
+             * @param bytes maximal memory used by the entries (rounded down to a power of two per shard)
+             * @param numberOfShards number of shards (rounded up to a power of two)
+             */
+            explicit TranspositionTable(std::size_t bytes = 16U << 20U, std::size_t numberOfShards = 16);
+
+            /**
+             * reallocates table, all entries are lost (must not be called while other threads use the table)
+             * @param bytes maximal memory used by the entries
+             */
+            void resize(std::size_t bytes);
+
+            /**
+             * removes all entries (must not be called while other threads use the table)
+             */
+            void clear();
+
+            /**
+             * starts new search, entries of older searches are replaced first
+             */
+            void newGeneration();
+
+            /**
+             * @param hash hash of position
+             * @return stored entry, nullopt if position is not in table
+             */
+            [[nodiscard]] std::optional<TranspositionEntry> probe(std::uint64_t hash) const;
+
+            /**
+             * stores entry, replaces entry of same position, else an empty, old or shallow entry of the bucket
+             * @param hash hash of position
+             * @param entry result for position
+             */
+            void store(std::uint64_t hash, const TranspositionEntry &entry);
+
+            /**
+             * @return memory used by the entries in bytes
+             */
+            [[nodiscard]] std::size_t getSizeInBytes() const;
+
+            [[nodiscard]] std::size_t getNumberOfEntries() const;
+
+            /**
+             * @return counters summed over all shards (approximate while other threads use the table)
+             */
+            [[nodiscard]] TranspositionStatistics getStatistics() const;
+
+        private:
+            static constexpr std::size_t bucketSize = 4;
+
+            struct Slot {
+                std::atomic<std::uint64_t> check{0}; // hash ^ data
+                std::atomic<std::uint64_t> data{0};
+            };
+
+            struct alignas(64) Bucket {
+                Slot slots[bucketSize];
+            };
+
+            struct alignas(64) Shard {
+                std::unique_ptr<Bucket[]> buckets;
+                std::size_t mask = 0;
+                std::atomic<std::size_t> probes{0};
+                std::atomic<std::size_t> hits{0};
+                std::atomic<std::size_t> stores{0};
+                std::atomic<std::size_t> replacements{0};
+            };
+
+            std::unique_ptr<Shard[]> shards;
+            std::size_t numberOfShards;
+            unsigned int shardShift; // hash >> shardShift is shard index
+            std::size_t bucketsPerShard = 0;
+            std::atomic<std::uint8_t> generation{1};
+
+            [[nodiscard]] Shard &getShard(std::uint64_t hash) const;
+
+            [[nodiscard]] static std::uint64_t pack(const TranspositionEntry &entry, std::uint8_t generation);
+
+            [[nodiscard]] static TranspositionEntry unpack(std::uint64_t data);
+    };
+}
+
+#endif //LIBCLIENT_TRANSPOSITIONTABLE_HPP
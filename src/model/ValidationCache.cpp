@@ -0,0 +1,95 @@
+/**
+ * @file   ValidationCache.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the cache of validation results of game operations.
+ */
+
+#include "ValidationCache.hpp"
+#include <util/MemoryUtils.hpp>
+#include <util/OperationDispatch.hpp>
+
+namespace libclient::model {
+
+    bool OperationKey::operator==(const OperationKey &other) const {
+        return type == other.type && target == other.target && detail == other.detail &&
+               character == other.character;
+    }
+
+    std::size_t OperationKeyHash::operator()(const OperationKey &key) const {
+        // character is the active character for all keys of one state version -> not hashed
+        std::size_t h = static_cast<std::size_t>(key.type);
+        h = h * 31 + static_cast<std::size_t>(key.target.x);
+        h = h * 31 + static_cast<std::size_t>(key.target.y);
+        h = h * 31 + static_cast<std::size_t>(key.detail);
+        return h;
+    }
+
+    OperationKey ValidationCache::makeKey(const spy::gameplay::BaseOperation &operation) {
+        using spy::gameplay::OperationEnum;
+
+        OperationKey key;
+        key.type = operation.getType();
+        key.target = operation.getTarget();
+        if (auto characterOperation = util::asCharacterOperation(operation)) {
+            key.character = characterOperation->getCharacterId();
+        }
+        switch (key.type) {
+            case OperationEnum::GADGET_ACTION:
+                key.detail = static_cast<int>(
+                        static_cast<const spy::gameplay::GadgetAction &>(operation).getGadget());
+                break;
+            case OperationEnum::GAMBLE_ACTION:
+                key.detail = static_cast<int>(
+                        static_cast<const spy::gameplay::GambleAction &>(operation).getStake());
+                break;
+            case OperationEnum::PROPERTY_ACTION:
+                key.detail = static_cast<int>(
+                        static_cast<const spy::gameplay::PropertyAction &>(operation).getUsedProperty());
+                break;
+            default:
+                break;
+        }
+        return key;
+    }
+
+    std::optional<bool> ValidationCache::lookup(const OperationKey &key, std::size_t version,
+                                                const spy::util::UUID &active, spy::network::RoleEnum role) {
+        select(version, active, role);
+        auto it = results.find(key);
+        if (it == results.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void ValidationCache::store(const OperationKey &key, bool valid, std::size_t version,
+                                const spy::util::UUID &active, spy::network::RoleEnum role) {
+        select(version, active, role);
+        results[key] = valid;
+    }
+
+    void ValidationCache::recordSubmission(double seconds, bool cacheHit) {
+        statistics.submissions++;
+        statistics.cacheHits += cacheHit;
+        statistics.lastSeconds = seconds;
+        statistics.totalSeconds += seconds;
+    }
+
+    const ValidationStatistics &ValidationCache::getStatistics() const {
+        return statistics;
+    }
+
+    std::size_t ValidationCache::getSizeInBytes() const {
+        return results.size() * (util::hashNodeOverhead + sizeof(std::pair<const OperationKey, bool>));
+    }
+
+    void ValidationCache::select(std::size_t version, const spy::util::UUID &active, spy::network::RoleEnum role) {
+        if (version != cachedVersion || active != cachedActive || role != cachedRole) {
+            results.clear();
+            cachedVersion = version;
+            cachedActive = active;
+            cachedRole = role;
+        }
+    }
+}
@@ -0,0 +1,114 @@
+/**
+ * @file   ValidationCache.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the cache of validation results of game operations.
+ */
+
+#ifndef LIBCLIENT_VALIDATIONCACHE_HPP
+#define LIBCLIENT_VALIDATIONCACHE_HPP
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <datatypes/gameplay/BaseOperation.hpp>
+#include <network/RoleEnum.hpp>
+
+namespace libclient::model {
+
+    /**
+     * identifies an operation of the active character (type, target and gadget, stake or property)
+     */
+    struct OperationKey {
+        spy::gameplay::OperationEnum type = spy::gameplay::OperationEnum::INVALID;
+        spy::util::Point target;
+        spy::util::UUID character;
+        int detail = 0;
+
+        bool operator==(const OperationKey &other) const;
+    };
+
+    struct OperationKeyHash {
+        std::size_t operator()(const OperationKey &key) const;
+    };
+
+    /**
+     * latency of Network::sendGameOperation
+     */
+    struct ValidationStatistics {
+        std::size_t submissions = 0;
+        std::size_t cacheHits = 0; // submissions that did not run GameOperation::validate
+        double lastSeconds = 0; // validation time of last submission
+        double totalSeconds = 0; // validation time of all submissions
+    };
+
+    /**
+     * validation time of the legal operations of the current request, without cache (as before the cache) and
+     * with cache (lookup of operations known to be legal)
+     */
+    struct ValidationBenchmark {
+        std::size_t operations = 0; // validations per repetition
+        std::size_t repetitions = 0;
+        double uncachedSeconds = 0; // mean time of GameOperation::validate per operation
+        double cachedSeconds = 0; // mean time of ValidationCache::lookup per operation
+        std::size_t mismatches = 0; // generated operations rejected by GameOperation::validate (should be 0)
+    };
+
+    /**
+     * results of GameOperation::validate with the match config of the model for the current state version, active
+     * character and role
+     * the legal operations of the current request are validated when they are generated, so validating one of them
+     * again is a hash lookup, all other results are memoized until state, active character or role change
+     */
+    class ValidationCache {
+        public:
+            /**
+             * @param operation operation to identify
+             * @return key of operation
+             */
+            [[nodiscard]] static OperationKey makeKey(const spy::gameplay::BaseOperation &operation);
+
+            /**
+             * @param key key of operation
+             * @param version current state version
+             * @param active active character
+             * @param role role of the client
+             * @return cached validation result, nullopt if unknown
+             */
+            [[nodiscard]] std::optional<bool> lookup(const OperationKey &key, std::size_t version,
+                                                     const spy::util::UUID &active, spy::network::RoleEnum role);
+
+            /**
+             * memoizes result of GameOperation::validate
+             */
+            void store(const OperationKey &key, bool valid, std::size_t version, const spy::util::UUID &active,
+                       spy::network::RoleEnum role);
+
+            /**
+             * @param seconds time spent validating the submission
+             * @param cacheHit true if validation was answered by the cache
+             */
+            void recordSubmission(double seconds, bool cacheHit);
+
+            [[nodiscard]] const ValidationStatistics &getStatistics() const;
+
+            /**
+             * @return approximate heap memory of the cache in bytes
+             */
+            [[nodiscard]] std::size_t getSizeInBytes() const;
+
+        private:
+            std::size_t cachedVersion = 0;
+            spy::util::UUID cachedActive;
+            spy::network::RoleEnum cachedRole = spy::network::RoleEnum::SPECTATOR;
+            std::unordered_map<OperationKey, bool, OperationKeyHash> results;
+            ValidationStatistics statistics;
+
+            /**
+             * drops results if state, active character or role changed
+             */
+            void select(std::size_t version, const spy::util::UUID &active, spy::network::RoleEnum role);
+    };
+}
+
+#endif //LIBCLIENT_VALIDATIONCACHE_HPP
@@ -0,0 +1,192 @@
+/**
+ * @file   Zobrist.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the zobrist keys hashing states together with AIState facts.
+ */
+
+#include "Zobrist.hpp"
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <variant>
+
+namespace libclient::model {
+
+    namespace {
+        std::size_t factionIndex(spy::character::FactionEnum faction) {
+            using spy::character::FactionEnum;
+            return faction == FactionEnum::PLAYER1 ? 0 : faction == FactionEnum::PLAYER2 ? 1 : 2;
+        }
+    }
+
+    ZobristKeys::ZobristKeys(const spy::gameplay::State &s, std::uint64_t keySeed) : seed(keySeed) {
+        indexer = util::FieldIndexer(s.getMap().getMap());
+        numberOfFields = indexer.getNumberOfFields();
+
+        for (const auto &c: s.getCharacters()) {
+            characterIndices.emplace(c.getCharacterId(), characterIndices.size());
+        }
+        auto characters = characterIndices.size();
+
+        std::mt19937_64 rng(seed);
+        auto fill = [&rng](std::vector<std::uint64_t> &keys, std::size_t size) {
+            keys.resize(size);
+            std::generate(keys.begin(), keys.end(), std::ref(rng));
+        };
+        fill(positionKeys, characters * (numberOfFields + 1));
+        fill(pointKeys, characters * 4 * maxPoints);
+        fill(gadgetKeys, characters * numberOfGadgetTypes);
+        fill(fieldKeys, numberOfFields * 8);
+        fill(fieldGadgetKeys, numberOfFields * numberOfGadgetTypes);
+        fill(factionKeys, characters * 6);
+        fill(ownerKeys, numberOfGadgetTypes * (characters + 1));
+    }
+
+    std::uint64_t ZobristKeys::hashState(const spy::gameplay::State &s) const {
+        std::uint64_t hash = mix(seed ^ s.getCurrentRound());
+
+        for (const auto &c: s.getCharacters()) {
+            auto index = getCharacterIndex(c.getCharacterId());
+            if (!index.has_value()) {
+                continue;
+            }
+            auto i = index.value();
+            hash ^= position(i, c.getCoordinates());
+            hash ^= points(i, ZobristPoints::MOVE_POINTS, c.getMovePoints());
+            hash ^= points(i, ZobristPoints::ACTION_POINTS, c.getActionPoints());
+            hash ^= points(i, ZobristPoints::HEALTH_POINTS, c.getHealthPoints());
+            hash ^= points(i, ZobristPoints::CHIPS, c.getChips());
+            for (const auto &gadget: c.getGadgets()) {
+                hash ^= heldGadget(i, gadget->getType());
+            }
+        }
+
+        const auto &rows = s.getMap().getMap();
+        for (auto y = 0U; y < rows.size(); y++) {
+            for (auto x = 0U; x < rows[y].size(); x++) {
+                const auto &f = rows[y][x];
+                spy::util::Point p{static_cast<int>(x), static_cast<int>(y)};
+                hash ^= field(p, f.getFieldState());
+                if (f.isFoggy()) {
+                    hash ^= fog(p);
+                }
+                if (f.getGadget().has_value()) {
+                    hash ^= fieldGadget(p, f.getGadget().value()->getType());
+                }
+            }
+        }
+        return hash;
+    }
+
+    std::uint64_t ZobristKeys::hashBeliefs(const AIState &ai) const {
+        std::uint64_t hash = 0;
+        auto characters = characterIndices.size();
+
+        auto hashFaction = [this, &hash](const std::set<spy::util::UUID> &list, std::size_t faction) {
+            for (const auto &id: list) {
+                auto index = getCharacterIndex(id);
+                if (index.has_value()) {
+                    hash ^= factionKeys[(index.value() * 2) * 3 + faction];
+                }
+            }
+        };
+        hashFaction(ai.myFaction, 0);
+        hashFaction(ai.enemyFaction, 1);
+        hashFaction(ai.npcFaction, 2);
+        for (const auto &[id, factions]: ai.excludedFactions) {
+            auto index = getCharacterIndex(id);
+            if (!index.has_value()) {
+                continue;
+            }
+            for (auto faction: factions) {
+                hash ^= factionKeys[(index.value() * 2 + 1) * 3 + factionIndex(faction)];
+            }
+        }
+
+        // owners are only hashed when known, candidates of unknownGadgets (and of unknownFaction above) are not
+        for (const auto &[gadget, id]: ai.characterGadgets) {
+            auto index = getCharacterIndex(id);
+            if (index.has_value()) {
+                hash ^= ownerKeys[static_cast<std::size_t>(gadget->getType()) * (characters + 1) + index.value()];
+            }
+        }
+        for (const auto &gadget: ai.floorGadgets) {
+            hash ^= ownerKeys[static_cast<std::size_t>(gadget->getType()) * (characters + 1) + characters];
+        }
+
+        for (const auto &cocktail: ai.poisonedCocktails) {
+            if (std::holds_alternative<spy::util::UUID>(cocktail)) {
+                auto index = getCharacterIndex(std::get<spy::util::UUID>(cocktail));
+                hash ^= belief(1, index.value_or(characters));
+            } else {
+                hash ^= belief(2, fieldIndex(std::get<spy::util::Point>(cocktail)));
+            }
+        }
+        for (auto safe: ai.openedSafes) {
+            hash ^= belief(3, safe);
+        }
+        for (auto safe: ai.safeCombinations) {
+            hash ^= belief(4, safe);
+        }
+        if (ai.posOfInvertedRoulette.has_value()) {
+            hash ^= belief(5, fieldIndex(ai.posOfInvertedRoulette.value()));
+        }
+        if (ai.gotRidOfMoleDie) {
+            hash ^= belief(6, 0);
+        }
+        return hash;
+    }
+
+    std::optional<std::size_t> ZobristKeys::getCharacterIndex(const spy::util::UUID &id) const {
+        auto it = characterIndices.find(id);
+        if (it == characterIndices.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    std::uint64_t ZobristKeys::position(std::size_t character, const std::optional<spy::util::Point> &p) const {
+        auto f = p.has_value() ? fieldIndex(p.value()) : numberOfFields;
+        return positionKeys[character * (numberOfFields + 1) + f];
+    }
+
+    std::uint64_t ZobristKeys::points(std::size_t character, ZobristPoints type, unsigned int value) const {
+        return pointKeys[(character * 4 + static_cast<std::size_t>(type)) * maxPoints + value % maxPoints];
+    }
+
+    std::uint64_t ZobristKeys::heldGadget(std::size_t character, spy::gadget::GadgetEnum type) const {
+        return gadgetKeys[character * numberOfGadgetTypes + static_cast<std::size_t>(type)];
+    }
+
+    std::uint64_t ZobristKeys::field(const spy::util::Point &p, spy::scenario::FieldStateEnum state) const {
+        auto f = fieldIndex(p);
+        return f < numberOfFields ? fieldKeys[f * 8 + static_cast<std::size_t>(state)] : 0;
+    }
+
+    std::uint64_t ZobristKeys::fog(const spy::util::Point &p) const {
+        auto f = fieldIndex(p);
+        return f < numberOfFields ? fieldKeys[f * 8 + 7] : 0;
+    }
+
+    std::uint64_t ZobristKeys::fieldGadget(const spy::util::Point &p, spy::gadget::GadgetEnum type) const {
+        auto f = fieldIndex(p);
+        return f < numberOfFields ? fieldGadgetKeys[f * numberOfGadgetTypes + static_cast<std::size_t>(type)] : 0;
+    }
+
+    std::uint64_t ZobristKeys::mix(std::uint64_t value) {
+        // splitmix64 finalizer
+        value += 0x9E3779B97F4A7C15;
+        value = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9;
+        value = (value ^ (value >> 27U)) * 0x94D049BB133111EB;
+        return value ^ (value >> 31U);
+    }
+
+    std::size_t ZobristKeys::fieldIndex(const spy::util::Point &p) const {
+        return indexer.getIndex(p).value_or(numberOfFields);
+    }
+
+    std::uint64_t ZobristKeys::belief(std::uint64_t feature, std::uint64_t value) const {
+        return mix(seed ^ (feature << 56U) ^ value);
+    }
+}
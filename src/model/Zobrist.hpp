@@ -0,0 +1,104 @@
+/**
+ * @file   Zobrist.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the zobrist keys hashing states together with AIState facts.
+ */
+
+#ifndef LIBCLIENT_ZOBRIST_HPP
+#define LIBCLIENT_ZOBRIST_HPP
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+#include <datatypes/gameplay/State.hpp>
+#include <model/AIState.hpp>
+#include <util/FieldIndexer.hpp>
+#include <util/GadgetTypes.hpp>
+
+namespace libclient::model {
+
+    enum class ZobristPoints {
+        MOVE_POINTS, ACTION_POINTS, HEALTH_POINTS, CHIPS
+    };
+
+    /**
+     * random keys per feature of a state (character positions and points, held gadgets, field states, fog, gadgets on
+     * fields) and of AIState (faction lists, excluded factions, gadget owners, poisoned cocktails, safes), the hash of a
+     * position is the xor of the keys of its features, so changing one feature costs two xors
+     * keys are deterministic for the same seed and level, hashes of different ZobristKeys objects built from the same
+     * match can be mixed (e.g. in a transposition table shared by several threads)
+     */
+    class ZobristKeys {
+        public:
+            static constexpr std::size_t numberOfGadgetTypes = util::numberOfGadgetTypes; // including INVALID
+            static constexpr std::size_t maxPoints = 128; // larger values share keys with value % maxPoints
+
+            /**
+             * @param s state defining map size and characters (characters are indexed in order of the character set)
+             * @param seed seed of the keys
+             */
+            explicit ZobristKeys(const spy::gameplay::State &s, std::uint64_t seed = 0x9E3779B97F4A7C15);
+
+            /**
+             * @return hash of all state features
+             */
+            [[nodiscard]] std::uint64_t hashState(const spy::gameplay::State &s) const;
+
+            /**
+             * hashes all AIState facts in one pass, there are no incremental updates for them
+             * @note the certainties in unknownFaction and unknownGadgets are intentionally not hashed (owner keys
+             *       only cover characterGadgets and floorGadgets): they are soft evidence that is re-weighted by the
+             *       belief sampler, positions that only differ in them share a hash and a transposition table entry
+             * @return hash of all AIState facts
+             */
+            [[nodiscard]] std::uint64_t hashBeliefs(const AIState &ai) const;
+
+            /**
+             * @param id character id
+             * @return index of character, nullopt if character was not in the state the keys were built from
+             */
+            [[nodiscard]] std::optional<std::size_t> getCharacterIndex(const spy::util::UUID &id) const;
+
+            /**
+             * @param character index of character
+             * @param p position, nullopt if character is not on the map
+             */
+            [[nodiscard]] std::uint64_t position(std::size_t character, const std::optional<spy::util::Point> &p) const;
+
+            [[nodiscard]] std::uint64_t points(std::size_t character, ZobristPoints type, unsigned int value) const;
+
+            [[nodiscard]] std::uint64_t heldGadget(std::size_t character, spy::gadget::GadgetEnum type) const;
+
+            [[nodiscard]] std::uint64_t field(const spy::util::Point &p, spy::scenario::FieldStateEnum state) const;
+
+            [[nodiscard]] std::uint64_t fog(const spy::util::Point &p) const;
+
+            [[nodiscard]] std::uint64_t fieldGadget(const spy::util::Point &p, spy::gadget::GadgetEnum type) const;
+
+            /**
+             * @return key of a value without table (e.g. round number, safe index or number of a determinization)
+             */
+            [[nodiscard]] static std::uint64_t mix(std::uint64_t value);
+
+        private:
+            std::uint64_t seed;
+            util::FieldIndexer indexer;
+            std::size_t numberOfFields = 0;
+            std::map<spy::util::UUID, std::size_t> characterIndices;
+            std::vector<std::uint64_t> positionKeys; // character * (fields + 1) + field, last field is off map
+            std::vector<std::uint64_t> pointKeys; // (character * 4 + type) * maxPoints + value
+            std::vector<std::uint64_t> gadgetKeys; // character * gadget types + type
+            std::vector<std::uint64_t> fieldKeys; // field * 8 + field state, field * 8 + 7 is fog
+            std::vector<std::uint64_t> fieldGadgetKeys; // field * gadget types + type
+            std::vector<std::uint64_t> factionKeys; // (character * 2 + excluded) * 3 + faction
+            std::vector<std::uint64_t> ownerKeys; // type * (characters + 1) + character, last column is floor
+
+            [[nodiscard]] std::size_t fieldIndex(const spy::util::Point &p) const;
+
+            [[nodiscard]] std::uint64_t belief(std::uint64_t feature, std::uint64_t value) const;
+    };
+}
+
+#endif //LIBCLIENT_ZOBRIST_HPP
@@ -0,0 +1,50 @@
+/**
+ * @file   AllocationCounter.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the counters of heap allocations (incremented by util/AllocationHook.cpp).
+ */
+
+#include "AllocationCounter.hpp"
+#include <algorithm>
+#include <atomic>
+
+namespace libclient::util {
+
+    namespace {
+        // trivial thread local, safe to use inside operator new
+        thread_local AllocationCount threadAllocations;
+        std::atomic<bool> hookLinked{false};
+    }
+
+    void AllocationStatistics::record(const AllocationCount &count) {
+        calls++;
+        total += count;
+        max.allocations = std::max(max.allocations, count.allocations);
+        max.bytes = std::max(max.bytes, count.bytes);
+    }
+
+    bool AllocationCounter::isAvailable() {
+        return hookLinked;
+    }
+
+    AllocationCount AllocationCounter::get() {
+        return threadAllocations;
+    }
+
+    void AllocationCounter::record(std::size_t bytes) noexcept {
+        threadAllocations.allocations++;
+        threadAllocations.bytes += bytes;
+    }
+
+    void AllocationCounter::setAvailable() noexcept {
+        hookLinked = true;
+    }
+
+    AllocationScope::AllocationScope() : start(AllocationCounter::get()) {}
+
+    AllocationCount AllocationScope::get() const {
+        auto now = AllocationCounter::get();
+        return AllocationCount{now.allocations - start.allocations, now.bytes - start.bytes};
+    }
+}
@@ -0,0 +1,114 @@
+/**
+ * @file   AllocationCounter.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the counters of heap allocations of the calling thread.
+ */
+
+#ifndef LIBCLIENT_ALLOCATIONCOUNTER_HPP
+#define LIBCLIENT_ALLOCATIONCOUNTER_HPP
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+
+namespace libclient::util {
+
+    struct AllocationCount {
+        std::size_t allocations = 0;
+        std::size_t bytes = 0;
+
+        AllocationCount &operator+=(const AllocationCount &other) {
+            allocations += other.allocations;
+            bytes += other.bytes;
+            return *this;
+        }
+    };
+
+    /**
+     * allocations of repeated calls of one code path
+     */
+    struct AllocationStatistics {
+        std::size_t calls = 0;
+        AllocationCount total;
+        AllocationCount max; // of a single call, allocations and bytes are maximized independently
+
+        void record(const AllocationCount &count);
+    };
+
+    /**
+     * counts calls of the global operator new per thread, the library itself never replaces operator new: the
+     * counting operator new is the object library LibClientAllocHook (util/AllocationHook.cpp), which an executable
+     * has to link explicitly, else all counts stay 0
+     */
+    class AllocationCounter {
+        public:
+            /**
+             * @return true if LibClientAllocHook is linked into the executable
+             */
+            [[nodiscard]] static bool isAvailable();
+
+            /**
+             * @return allocations of the calling thread since its start
+             */
+            [[nodiscard]] static AllocationCount get();
+
+            /**
+             * counts one allocation of the calling thread, called by the operator new of LibClientAllocHook
+             * @param bytes requested size
+             */
+            static void record(std::size_t bytes) noexcept;
+
+            /**
+             * called once by LibClientAllocHook during static initialization
+             */
+            static void setAvailable() noexcept;
+    };
+
+    /**
+     * counts allocations of the calling thread since construction, e.g. around processing of one message
+     */
+    class AllocationScope {
+        public:
+            AllocationScope();
+
+            /**
+             * @return allocations of the calling thread since construction
+             */
+            [[nodiscard]] AllocationCount get() const;
+
+        private:
+            AllocationCount start;
+    };
+
+    /**
+     * AllocationStatistics per key (e.g. message type), can be used by several threads
+     */
+    template<typename Key>
+    class AllocationRegistry {
+        public:
+            void record(const Key &key, const AllocationCount &count) {
+                std::lock_guard<std::mutex> lock(mutex);
+                statistics[key].record(count);
+            }
+
+            /**
+             * @return copy of the statistics of all recorded keys
+             */
+            [[nodiscard]] std::map<Key, AllocationStatistics> get() const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return statistics;
+            }
+
+            void clear() {
+                std::lock_guard<std::mutex> lock(mutex);
+                statistics.clear();
+            }
+
+        private:
+            mutable std::mutex mutex;
+            std::map<Key, AllocationStatistics> statistics;
+    };
+}
+
+#endif //LIBCLIENT_ALLOCATIONCOUNTER_HPP
@@ -0,0 +1,66 @@
+/**
+ * @file   AllocationHook.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Counting replacement of the global operator new, only part of executables that link LibClientAllocHook.
+ */
+
+#include <cstdlib>
+#include <new>
+#include <util/AllocationCounter.hpp>
+
+namespace {
+    // counts of the library stay 0 until this object file is linked into the executable
+    [[maybe_unused]] const bool registered = (libclient::util::AllocationCounter::setAvailable(), true);
+
+    void *countedAllocate(std::size_t size) noexcept {
+        libclient::util::AllocationCounter::record(size);
+        return std::malloc(size == 0 ? 1 : size);
+    }
+}
+
+// replaces the global (not over aligned) operators, over aligned ones keep their default pair of new and delete
+
+void *operator new(std::size_t size) {
+    auto p = countedAllocate(size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    return countedAllocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+    return countedAllocate(size);
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+    std::free(p);
+}
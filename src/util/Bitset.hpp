@@ -0,0 +1,200 @@
+/**
+ * @file   Bitset.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Bitset with size chosen at runtime (one bit per safe / field).
+ */
+
+#ifndef LIBCLIENT_BITSET_HPP
+#define LIBCLIENT_BITSET_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace libclient::util {
+
+    /**
+     * fixed size bitset whose size is set at runtime, operations work on 64 bit words
+     */
+    class Bitset {
+        public:
+            Bitset() = default;
+
+            explicit Bitset(std::size_t size) : bits(size), words((size + 63) / 64, 0) {}
+
+            [[nodiscard]] std::size_t size() const {
+                return bits;
+            }
+
+            [[nodiscard]] bool test(std::size_t i) const {
+                return i < bits && (words[i / 64] >> (i % 64)) & 1U;
+            }
+
+            void set(std::size_t i, bool value = true) {
+                if (i >= bits) {
+                    return;
+                }
+                if (value) {
+                    words[i / 64] |= std::uint64_t{1} << (i % 64);
+                } else {
+                    words[i / 64] &= ~(std::uint64_t{1} << (i % 64));
+                }
+            }
+
+            void reset(std::size_t i) {
+                set(i, false);
+            }
+
+            void clear() {
+                std::fill(words.begin(), words.end(), 0);
+            }
+
+            [[nodiscard]] std::size_t count() const {
+                std::size_t c = 0;
+                for (auto w: words) {
+                    c += static_cast<std::size_t>(__builtin_popcountll(w));
+                }
+                return c;
+            }
+
+            [[nodiscard]] bool any() const {
+                for (auto w: words) {
+                    if (w != 0) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            [[nodiscard]] bool none() const {
+                return !any();
+            }
+
+            Bitset &operator&=(const Bitset &other) {
+                for (std::size_t w = 0; w < words.size(); w++) {
+                    words[w] &= w < other.words.size() ? other.words[w] : 0;
+                }
+                return *this;
+            }
+
+            Bitset &operator|=(const Bitset &other) {
+                for (std::size_t w = 0; w < words.size() && w < other.words.size(); w++) {
+                    words[w] |= other.words[w];
+                }
+                trim();
+                return *this;
+            }
+
+            /**
+             * removes all bits set in other (this & ~other)
+             */
+            Bitset &subtract(const Bitset &other) {
+                for (std::size_t w = 0; w < words.size() && w < other.words.size(); w++) {
+                    words[w] &= ~other.words[w];
+                }
+                return *this;
+            }
+
+            /**
+             * moves every bit i to i + n, bits moved behind size() are dropped
+             */
+            Bitset &operator<<=(std::size_t n) {
+                auto wordShift = n / 64;
+                auto bitShift = n % 64;
+                for (auto w = words.size(); w-- > 0;) {
+                    std::uint64_t word = 0;
+                    if (w >= wordShift) {
+                        word = words[w - wordShift] << bitShift;
+                        if (bitShift != 0 && w >= wordShift + 1) {
+                            word |= words[w - wordShift - 1] >> (64 - bitShift);
+                        }
+                    }
+                    words[w] = word;
+                }
+                trim();
+                return *this;
+            }
+
+            /**
+             * moves every bit i to i - n, bits moved below 0 are dropped
+             */
+            Bitset &operator>>=(std::size_t n) {
+                auto wordShift = n / 64;
+                auto bitShift = n % 64;
+                for (std::size_t w = 0; w < words.size(); w++) {
+                    std::uint64_t word = 0;
+                    if (w + wordShift < words.size()) {
+                        word = words[w + wordShift] >> bitShift;
+                        if (bitShift != 0 && w + wordShift + 1 < words.size()) {
+                            word |= words[w + wordShift + 1] << (64 - bitShift);
+                        }
+                    }
+                    words[w] = word;
+                }
+                return *this;
+            }
+
+            friend Bitset operator&(Bitset a, const Bitset &b) {
+                return a &= b;
+            }
+
+            friend Bitset operator|(Bitset a, const Bitset &b) {
+                return a |= b;
+            }
+
+            friend Bitset operator<<(Bitset a, std::size_t n) {
+                return a <<= n;
+            }
+
+            friend Bitset operator>>(Bitset a, std::size_t n) {
+                return a >>= n;
+            }
+
+            bool operator==(const Bitset &other) const {
+                return bits == other.bits && words == other.words;
+            }
+
+            bool operator!=(const Bitset &other) const {
+                return !(*this == other);
+            }
+
+            /**
+             * calls function(i) for every set bit in ascending order
+             */
+            template<typename Function>
+            void forEach(Function &&function) const {
+                for (std::size_t w = 0; w < words.size(); w++) {
+                    auto word = words[w];
+                    while (word != 0) {
+                        auto bit = static_cast<std::size_t>(__builtin_ctzll(word));
+                        function(w * 64 + bit);
+                        word &= word - 1;
+                    }
+                }
+            }
+
+            [[nodiscard]] const std::vector<std::uint64_t> &getWords() const {
+                return words;
+            }
+
+            [[nodiscard]] std::vector<std::uint64_t> &getWords() {
+                return words;
+            }
+
+            /**
+             * clears bits behind size() in last word (after word wise operations)
+             */
+            void trim() {
+                if (bits % 64 != 0 && !words.empty()) {
+                    words.back() &= (std::uint64_t{1} << (bits % 64)) - 1;
+                }
+            }
+
+        private:
+            std::size_t bits = 0;
+            std::vector<std::uint64_t> words;
+    };
+}
+
+#endif //LIBCLIENT_BITSET_HPP
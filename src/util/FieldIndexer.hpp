@@ -0,0 +1,92 @@
+/**
+ * @file   FieldIndexer.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Row major numbering of the fields of a (possibly ragged) map shared by all per field tables.
+ */
+
+#ifndef LIBCLIENT_FIELDINDEXER_HPP
+#define LIBCLIENT_FIELDINDEXER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <util/Point.hpp>
+
+namespace libclient::util {
+
+    /**
+     * numbers fields row major as y * width + x, width is the length of the longest row
+     * (rows of a level may have different lengths, missing fields just get no entry in the tables)
+     */
+    class FieldIndexer {
+        public:
+            FieldIndexer() = default;
+
+            /**
+             * @param rows rows of a level or map (anything with size() per row)
+             */
+            template<typename Rows>
+            explicit FieldIndexer(const Rows &rows) : height(rows.size()) {
+                for (const auto &row: rows) {
+                    width = std::max(width, row.size());
+                }
+            }
+
+            [[nodiscard]] std::size_t getWidth() const {
+                return width;
+            }
+
+            [[nodiscard]] std::size_t getHeight() const {
+                return height;
+            }
+
+            /**
+             * @return size of tables with one entry per field
+             */
+            [[nodiscard]] std::size_t getNumberOfFields() const {
+                return width * height;
+            }
+
+            [[nodiscard]] bool contains(const spy::util::Point &p) const {
+                return p.x >= 0 && p.y >= 0 && static_cast<std::size_t>(p.x) < width &&
+                       static_cast<std::size_t>(p.y) < height;
+            }
+
+            /**
+             * @param p position
+             * @return index of field, nullopt if p is outside of the map
+             */
+            [[nodiscard]] std::optional<std::size_t> getIndex(const spy::util::Point &p) const {
+                if (!contains(p)) {
+                    return std::nullopt;
+                }
+                return getIndex(static_cast<std::size_t>(p.x), static_cast<std::size_t>(p.y));
+            }
+
+            /**
+             * @return index of field (x, y), unchecked
+             */
+            [[nodiscard]] std::size_t getIndex(std::size_t x, std::size_t y) const {
+                return y * width + x;
+            }
+
+            [[nodiscard]] spy::util::Point getPoint(std::size_t index) const {
+                return spy::util::Point{static_cast<int>(index % width), static_cast<int>(index / width)};
+            }
+
+            bool operator==(const FieldIndexer &other) const {
+                return width == other.width && height == other.height;
+            }
+
+            bool operator!=(const FieldIndexer &other) const {
+                return !(*this == other);
+            }
+
+        private:
+            std::size_t width = 0;
+            std::size_t height = 0;
+    };
+}
+
+#endif //LIBCLIENT_FIELDINDEXER_HPP
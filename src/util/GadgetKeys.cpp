@@ -0,0 +1,45 @@
+/**
+ * @file   GadgetKeys.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of the pool of interned gadget keys.
+ */
+
+#include "GadgetKeys.hpp"
+#include <array>
+
+namespace libclient::util {
+
+    namespace {
+        using KeyArray = std::array<std::shared_ptr<const spy::gadget::Gadget>, GadgetKeys::numberOfGadgetTypes>;
+
+        const KeyArray &getKeys() {
+            // initialization of function local statics is thread safe
+            static const KeyArray keys = [] {
+                KeyArray k;
+                for (std::size_t type = 0; type < GadgetKeys::numberOfGadgetTypes; type++) {
+                    k[type] = std::make_shared<const spy::gadget::Gadget>(spy::gadget::GadgetEnum(type));
+                }
+                return k;
+            }();
+            return keys;
+        }
+    }
+
+    const std::shared_ptr<const spy::gadget::Gadget> &GadgetKeys::get(spy::gadget::GadgetEnum type) {
+        auto index = static_cast<std::size_t>(type);
+        const auto &keys = getKeys();
+        return index < keys.size() ? keys[index] : keys[0];
+    }
+
+    const std::vector<spy::gadget::GadgetEnum> &GadgetKeys::getTypes() {
+        static const std::vector<spy::gadget::GadgetEnum> types = [] {
+            std::vector<spy::gadget::GadgetEnum> t;
+            for (std::size_t type = 1; type < numberOfGadgetTypes; type++) {
+                t.push_back(spy::gadget::GadgetEnum(type));
+            }
+            return t;
+        }();
+        return types;
+    }
+}
@@ -0,0 +1,41 @@
+/**
+ * @file   GadgetKeys.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of the pool of interned gadget keys.
+ */
+
+#ifndef LIBCLIENT_GADGETKEYS_HPP
+#define LIBCLIENT_GADGETKEYS_HPP
+
+#include <memory>
+#include <vector>
+#include <datatypes/gadgets/Gadget.hpp>
+#include <util/GadgetTypes.hpp>
+
+namespace libclient::util {
+
+    /**
+     * one immutable gadget per type, created once for the whole process and used to search the gadget lists of
+     * AIState (ordered by cmpGadgetPtr) without allocating
+     * keys are const, so they can not be inserted into these lists, whose gadgets are mutable (e.g. usages left)
+     * and owned by one AIState
+     */
+    class GadgetKeys {
+        public:
+            static constexpr std::size_t numberOfGadgetTypes = util::numberOfGadgetTypes; // including INVALID
+
+            /**
+             * @param type gadget type
+             * @return key of type, valid until the end of the program
+             */
+            [[nodiscard]] static const std::shared_ptr<const spy::gadget::Gadget> &get(spy::gadget::GadgetEnum type);
+
+            /**
+             * @return all gadget types except INVALID
+             */
+            [[nodiscard]] static const std::vector<spy::gadget::GadgetEnum> &getTypes();
+    };
+}
+
+#endif //LIBCLIENT_GADGETKEYS_HPP
@@ -0,0 +1,29 @@
+/**
+ * @file   GadgetTypes.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Number of gadget types shared by all tables indexed by GadgetEnum.
+ */
+
+#ifndef LIBCLIENT_GADGETTYPES_HPP
+#define LIBCLIENT_GADGETTYPES_HPP
+
+#include <cstddef>
+#include <datatypes/gadgets/GadgetEnum.hpp>
+
+namespace libclient::util {
+
+    // values of GadgetEnum including INVALID (0), gadgets are numbered 1..numberOfGadgetTypes - 1
+    constexpr std::size_t numberOfGadgetTypes = 22;
+
+    /**
+     * @param type gadget type
+     * @return true if type is a gadget (not INVALID or out of range)
+     */
+    constexpr bool isGadgetType(spy::gadget::GadgetEnum type) {
+        auto index = static_cast<std::size_t>(type);
+        return index > 0 && index < numberOfGadgetTypes;
+    }
+}
+
+#endif //LIBCLIENT_GADGETTYPES_HPP
@@ -0,0 +1,46 @@
+/**
+ * @file   MemoryUtils.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Approximate heap sizes of standard containers (libstdc++ layout on 64 bit).
+ */
+
+#ifndef LIBCLIENT_MEMORYUTILS_HPP
+#define LIBCLIENT_MEMORYUTILS_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace libclient::util {
+
+    // color, parent, left and right of a std::map / std::set node
+    constexpr std::size_t treeNodeOverhead = 4 * sizeof(void *);
+
+    // next pointer and cached hash of a std::unordered_map node plus its bucket
+    constexpr std::size_t hashNodeOverhead = 3 * sizeof(void *);
+
+    // control block of std::make_shared (vtable and two counters)
+    constexpr std::size_t sharedControlBlock = 2 * sizeof(void *);
+
+    /**
+     * @return heap memory of the elements of v (not of memory owned by the elements)
+     */
+    template<typename T>
+    std::size_t capacityInBytes(const std::vector<T> &v) {
+        return v.capacity() * sizeof(T);
+    }
+
+    inline std::size_t capacityInBytes(const std::vector<bool> &v) {
+        return v.capacity() / 8;
+    }
+
+    /**
+     * @return heap memory of s, 0 for short strings stored inside the object
+     */
+    inline std::size_t capacityInBytes(const std::string &s) {
+        return s.capacity() > 15 ? s.capacity() + 1 : 0;
+    }
+}
+
+#endif //LIBCLIENT_MEMORYUTILS_HPP
@@ -0,0 +1,103 @@
+/**
+ * @file   OperationDispatch.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Dispatch of operations to handlers of their concrete type without dynamic casts.
+ */
+
+#ifndef LIBCLIENT_OPERATIONDISPATCH_HPP
+#define LIBCLIENT_OPERATIONDISPATCH_HPP
+
+#include <datatypes/gameplay/BaseOperation.hpp>
+#include <datatypes/gameplay/CatAction.hpp>
+#include <datatypes/gameplay/CharacterOperation.hpp>
+#include <datatypes/gameplay/Exfiltration.hpp>
+#include <datatypes/gameplay/GadgetAction.hpp>
+#include <datatypes/gameplay/GambleAction.hpp>
+#include <datatypes/gameplay/JanitorAction.hpp>
+#include <datatypes/gameplay/Movement.hpp>
+#include <datatypes/gameplay/PropertyAction.hpp>
+#include <datatypes/gameplay/RetireAction.hpp>
+#include <datatypes/gameplay/SpyAction.hpp>
+
+namespace libclient::util {
+
+    /**
+     * combines lambdas to one visitor, e.g. visitOperation(op, Overloaded{[](const Movement &m) {...}, ...})
+     */
+    template<typename... Handlers>
+    struct Overloaded : Handlers ... {
+        using Handlers::operator()...;
+    };
+
+    template<typename... Handlers>
+    Overloaded(Handlers...) -> Overloaded<Handlers...>;
+
+    /**
+     * @param type type of operation
+     * @return true if operations of type are executed by a character (derived from CharacterOperation)
+     */
+    constexpr bool isCharacterOperation(spy::gameplay::OperationEnum type) {
+        using spy::gameplay::OperationEnum;
+        switch (type) {
+            case OperationEnum::GADGET_ACTION:
+            case OperationEnum::SPY_ACTION:
+            case OperationEnum::GAMBLE_ACTION:
+            case OperationEnum::PROPERTY_ACTION:
+            case OperationEnum::MOVEMENT:
+            case OperationEnum::EXFILTRATION:
+            case OperationEnum::RETIRE:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * resolves concrete type of operation once by its type (operations of LibCommon are always created as the class
+     * matching getType) and calls visitor with a const reference of that type, no RTTI and no reference counting
+     * overload resolution picks the most derived handler, so a handler for CharacterOperation or BaseOperation can
+     * serve as fallback, INVALID operations are passed as BaseOperation
+     * @param operation operation to be dispatched
+     * @param visitor callable with overloads for the handled operation types
+     * @return result of the called handler
+     */
+    template<typename Visitor>
+    decltype(auto) visitOperation(const spy::gameplay::BaseOperation &operation, Visitor &&visitor) {
+        using namespace spy::gameplay;
+        switch (operation.getType()) {
+            case OperationEnum::GADGET_ACTION:
+                return visitor(static_cast<const GadgetAction &>(operation));
+            case OperationEnum::SPY_ACTION:
+                return visitor(static_cast<const SpyAction &>(operation));
+            case OperationEnum::GAMBLE_ACTION:
+                return visitor(static_cast<const GambleAction &>(operation));
+            case OperationEnum::PROPERTY_ACTION:
+                return visitor(static_cast<const PropertyAction &>(operation));
+            case OperationEnum::MOVEMENT:
+                return visitor(static_cast<const Movement &>(operation));
+            case OperationEnum::CAT_ACTION:
+                return visitor(static_cast<const CatAction &>(operation));
+            case OperationEnum::JANITOR_ACTION:
+                return visitor(static_cast<const JanitorAction &>(operation));
+            case OperationEnum::EXFILTRATION:
+                return visitor(static_cast<const Exfiltration &>(operation));
+            case OperationEnum::RETIRE:
+                return visitor(static_cast<const RetireAction &>(operation));
+            default:
+                return visitor(operation);
+        }
+    }
+
+    /**
+     * @param operation any operation
+     * @return operation as CharacterOperation, nullptr for operations not executed by a character (cat, janitor)
+     */
+    inline const spy::gameplay::CharacterOperation *
+    asCharacterOperation(const spy::gameplay::BaseOperation &operation) {
+        return isCharacterOperation(operation.getType())
+               ? static_cast<const spy::gameplay::CharacterOperation *>(&operation) : nullptr;
+    }
+}
+
+#endif //LIBCLIENT_OPERATIONDISPATCH_HPP
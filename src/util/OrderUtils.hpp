@@ -5,9 +5,18 @@
 #ifndef LIBCLIENT_ORDERUTILS_HPP
 #define LIBCLIENT_ORDERUTILS_HPP
 
+#include <memory>
+#include <datatypes/gadgets/Gadget.hpp>
+
 namespace libclient::util {
+    /**
+     * orders gadgets by type, transparent -> maps of mutable gadgets can be searched with immutable keys (GadgetKeys)
+     */
     struct cmpGadgetPtr {
-        bool operator()(const std::shared_ptr<spy::gadget::Gadget> &a, const std::shared_ptr<spy::gadget::Gadget>& b) const {
+        using is_transparent = void;
+
+        template<typename A, typename B>
+        bool operator()(const std::shared_ptr<A> &a, const std::shared_ptr<B> &b) const {
             return a->getType() < b->getType();
         }
     };
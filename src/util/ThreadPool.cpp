@@ -0,0 +1,161 @@
+/**
+ * @file   ThreadPool.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Definition of a fixed size work stealing thread pool used by the AI helpers.
+ */
+
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace libclient::util {
+
+    namespace {
+        thread_local const ThreadPool *currentPool = nullptr;
+        thread_local std::size_t currentWorker = 0;
+    }
+
+    ThreadPool::ThreadPool(std::size_t numberOfThreads) {
+        if (numberOfThreads == 0) {
+            numberOfThreads = std::max(1U, std::thread::hardware_concurrency());
+        }
+        for (std::size_t i = 0; i < numberOfThreads; i++) {
+            queues.push_back(std::make_unique<Queue>());
+        }
+        workers.reserve(numberOfThreads);
+        for (std::size_t i = 0; i < numberOfThreads; i++) {
+            workers.emplace_back(&ThreadPool::work, this, i);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+        for (auto &worker: workers) {
+            worker.join();
+        }
+    }
+
+    std::size_t ThreadPool::getNumberOfThreads() const {
+        return workers.size();
+    }
+
+    std::future<void> ThreadPool::submit(std::function<void()> task) {
+        std::packaged_task<void()> packagedTask(std::move(task));
+        auto future = packagedTask.get_future();
+
+        auto worker = getCurrentWorker();
+        auto index = worker.has_value() ? worker.value() : nextQueue++ % queues.size();
+        {
+            // counted before the task is visible, else take could decrement first and wrap pending around
+            std::lock_guard<std::mutex> lock(mutex);
+            pending++;
+        }
+        {
+            std::lock_guard<std::mutex> lock(queues[index]->mutex);
+            queues[index]->tasks.push_back(std::move(packagedTask));
+        }
+        condition.notify_one();
+        return future;
+    }
+
+    void ThreadPool::parallelFor(std::size_t count,
+                                 const std::function<void(std::size_t, std::size_t, std::size_t)> &function) {
+        const auto chunks = std::min(count, workers.size());
+        if (chunks <= 1) {
+            if (count > 0) {
+                function(0, count, 0);
+            }
+            return;
+        }
+
+        std::vector<std::future<void>> futures;
+        futures.reserve(chunks);
+        for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+            auto begin = count * chunk / chunks;
+            auto end = count * (chunk + 1) / chunks;
+            futures.push_back(submit([&function, begin, end, chunk]() {
+                function(begin, end, chunk);
+            }));
+        }
+        // all chunks have to finish before function goes out of scope, even if one of them failed
+        for (auto &future: futures) {
+            wait(future);
+        }
+        for (auto &future: futures) {
+            // rethrows exceptions of the chunk
+            future.get();
+        }
+    }
+
+    void ThreadPool::wait(std::future<void> &future) {
+        auto worker = getCurrentWorker();
+        while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            std::packaged_task<void()> task;
+            if (take(worker.value_or(0), task)) {
+                task();
+            } else {
+                future.wait_for(std::chrono::microseconds(100));
+            }
+        }
+    }
+
+    std::optional<std::size_t> ThreadPool::getCurrentWorker() const {
+        if (currentPool != this) {
+            return std::nullopt;
+        }
+        return currentWorker;
+    }
+
+    std::size_t ThreadPool::getNumberOfSteals() const {
+        return steals;
+    }
+
+    bool ThreadPool::take(std::size_t index, std::packaged_task<void()> &task) {
+        bool found = false;
+        for (std::size_t i = 0; i < queues.size() && !found; i++) {
+            auto &queue = *queues[(index + i) % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            if (i == 0) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            } else {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                steals++;
+            }
+            found = true;
+        }
+
+        if (found) {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending--;
+        }
+        return found;
+    }
+
+    void ThreadPool::work(std::size_t index) {
+        currentPool = this;
+        currentWorker = index;
+        while (true) {
+            std::packaged_task<void()> task;
+            if (take(index, task)) {
+                task();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this]() { return stopping || pending > 0; });
+            if (stopping && pending == 0) {
+                return;
+            }
+        }
+    }
+}
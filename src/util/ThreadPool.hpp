@@ -0,0 +1,105 @@
+/**
+ * @file   ThreadPool.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Declaration of a fixed size work stealing thread pool used by the AI helpers.
+ */
+
+#ifndef LIBCLIENT_THREADPOOL_HPP
+#define LIBCLIENT_THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace libclient::util {
+
+    /**
+     * fixed number of worker threads, every worker has its own task queue
+     * tasks submitted by a worker go to its own queue (processed lifo), tasks submitted from outside are
+     * distributed round robin, idle workers steal the oldest task of other queues
+     */
+    class ThreadPool {
+        public:
+            /**
+             * starts worker threads
+             * @param numberOfThreads number of workers, 0 uses std::thread::hardware_concurrency
+             */
+            explicit ThreadPool(std::size_t numberOfThreads = 0);
+
+            ~ThreadPool();
+
+            ThreadPool(const ThreadPool &) = delete;
+
+            ThreadPool &operator=(const ThreadPool &) = delete;
+
+            [[nodiscard]] std::size_t getNumberOfThreads() const;
+
+            /**
+             * queues task for execution by a worker
+             * @param task task to be executed
+             * @return future that becomes ready when the task finished
+             */
+            std::future<void> submit(std::function<void()> task);
+
+            /**
+             * splits [0, count) into one chunk per worker and blocks until all chunks are processed,
+             * the calling thread executes queued tasks while waiting
+             * @param count number of items
+             * @param function called as function(begin, end, chunkIndex) for each chunk
+             * @throws first exception of a chunk (in chunk order) after all chunks finished
+             */
+            void parallelFor(std::size_t count,
+                             const std::function<void(std::size_t, std::size_t, std::size_t)> &function);
+
+            /**
+             * blocks until future is ready, the calling thread executes queued tasks while waiting
+             * (avoids deadlocks if a task waits for tasks it submitted)
+             */
+            void wait(std::future<void> &future);
+
+            /**
+             * @return index of the worker executing the calling thread, nullopt if called from another thread
+             */
+            [[nodiscard]] std::optional<std::size_t> getCurrentWorker() const;
+
+            /**
+             * @return number of tasks taken from the queue of another worker
+             */
+            [[nodiscard]] std::size_t getNumberOfSteals() const;
+
+        private:
+            struct Queue {
+                std::mutex mutex;
+                std::deque<std::packaged_task<void()>> tasks;
+            };
+
+            std::vector<std::thread> workers;
+            std::vector<std::unique_ptr<Queue>> queues;
+            std::atomic<std::size_t> nextQueue{0};
+            std::atomic<std::size_t> steals{0};
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::size_t pending = 0; // queued tasks, guarded by mutex
+            bool stopping = false;
+
+            /**
+             * takes task from own queue (newest) or steals from another queue (oldest)
+             * @param index queue to start with
+             * @param task taken task
+             * @return false if all queues are empty
+             */
+            bool take(std::size_t index, std::packaged_task<void()> &task);
+
+            void work(std::size_t index);
+    };
+}
+
+#endif //LIBCLIENT_THREADPOOL_HPP
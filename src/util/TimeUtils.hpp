@@ -0,0 +1,40 @@
+/**
+ * @file   TimeUtils.hpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Helpers for time limits of the match config.
+ */
+
+#ifndef LIBCLIENT_TIMEUTILS_HPP
+#define LIBCLIENT_TIMEUTILS_HPP
+
+#include <chrono>
+#include <optional>
+#include <datatypes/matchconfig/MatchConfig.hpp>
+
+namespace libclient::util {
+
+    namespace detail {
+        inline std::optional<unsigned int> toLimit(unsigned int seconds) {
+            return seconds > 0 ? std::optional<unsigned int>(seconds) : std::nullopt;
+        }
+
+        inline std::optional<unsigned int> toLimit(const std::optional<unsigned int> &seconds) {
+            return seconds.has_value() ? toLimit(seconds.value()) : std::nullopt;
+        }
+    }
+
+    /**
+     * @param config match config
+     * @return time a player has to answer RequestGameOperation, nullopt if there is no limit
+     */
+    inline std::optional<std::chrono::milliseconds> getTurnPhaseLimit(const spy::MatchConfig &config) {
+        auto seconds = detail::toLimit(config.getTurnPhaseLimit());
+        if (!seconds.has_value()) {
+            return std::nullopt;
+        }
+        return std::chrono::milliseconds(seconds.value() * 1000L);
+    }
+}
+
+#endif //LIBCLIENT_TIMEUTILS_HPP
@@ -0,0 +1,178 @@
+/**
+ * @file   AIStateTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of checkpoint, rollback and commit of the AIState.
+ */
+
+#include <gtest/gtest.h>
+#include <datatypes/gameplay/GadgetAction.hpp>
+#include <model/AIState.hpp>
+
+using libclient::model::AIState;
+using spy::gadget::Gadget;
+using spy::gadget::GadgetEnum;
+
+namespace {
+    std::shared_ptr<Gadget> addCharacterGadget(AIState &ai, GadgetEnum type, unsigned int usages,
+                                               const spy::util::UUID &owner) {
+        auto gadget = std::make_shared<Gadget>(type);
+        gadget->setUsagesLeft(usages);
+        ai.characterGadgets.emplace(gadget, owner);
+        return gadget;
+    }
+}
+
+TEST(AIState, withoutCheckpoint) {
+    AIState ai;
+    EXPECT_EQ(ai.getNumberOfCheckpoints(), 0U);
+    EXPECT_FALSE(ai.rollback());
+    EXPECT_FALSE(ai.commit());
+    EXPECT_FALSE(ai.changedSinceCheckpoint());
+}
+
+TEST(AIState, rollbackRestoresFactions) {
+    AIState ai;
+    auto id = spy::util::UUID::generate();
+    ai.unknownFaction[id] = {};
+    ai.excludedFactions[id] = {spy::character::FactionEnum::PLAYER1};
+
+    ai.checkpoint();
+    EXPECT_FALSE(ai.changedSinceCheckpoint());
+    ASSERT_TRUE(ai.addFaction(id, ai.enemyFaction));
+    EXPECT_TRUE(ai.changedSinceCheckpoint());
+    EXPECT_EQ(ai.enemyFaction.count(id), 1U);
+    EXPECT_EQ(ai.unknownFaction.count(id), 0U);
+    EXPECT_EQ(ai.excludedFactions.count(id), 0U);
+
+    ASSERT_TRUE(ai.rollback());
+    EXPECT_TRUE(ai.enemyFaction.empty());
+    EXPECT_EQ(ai.unknownFaction.count(id), 1U);
+    ASSERT_EQ(ai.excludedFactions.count(id), 1U);
+    EXPECT_EQ(ai.excludedFactions.at(id).count(spy::character::FactionEnum::PLAYER1), 1U);
+    EXPECT_EQ(ai.getNumberOfCheckpoints(), 0U);
+}
+
+TEST(AIState, rollbackRestoresUsages) {
+    AIState ai;
+    auto gadget = addCharacterGadget(ai, GadgetEnum::BOWLER_BLADE, 3, spy::util::UUID::generate());
+
+    // gadgets are changed in place while processing operations
+    ai.checkpoint();
+    gadget->setUsagesLeft(2);
+    ai.checkpoint();
+    gadget->setUsagesLeft(1);
+
+    ASSERT_TRUE(ai.rollback());
+    EXPECT_EQ(gadget->getUsagesLeft(), 2U);
+    ASSERT_TRUE(ai.rollback());
+    EXPECT_EQ(gadget->getUsagesLeft(), 3U);
+}
+
+TEST(AIState, rollbackRestoresUnknownGadgets) {
+    AIState ai;
+    ai.checkpoint();
+    ai.addUnknownGadgets();
+    EXPECT_FALSE(ai.unknownGadgets.empty());
+
+    ASSERT_TRUE(ai.rollback());
+    EXPECT_TRUE(ai.unknownGadgets.empty());
+}
+
+TEST(AIState, commitKeepsChangesForOuterCheckpoint) {
+    AIState ai;
+    auto first = spy::util::UUID::generate();
+    auto second = spy::util::UUID::generate();
+    ai.unknownFaction[first] = {};
+    ai.unknownFaction[second] = {};
+
+    ai.checkpoint();
+    ASSERT_TRUE(ai.addFaction(first, ai.myFaction));
+    ai.checkpoint();
+    ASSERT_TRUE(ai.addFaction(second, ai.npcFaction));
+    ASSERT_TRUE(ai.commit());
+    EXPECT_EQ(ai.getNumberOfCheckpoints(), 1U);
+    EXPECT_EQ(ai.npcFaction.count(second), 1U);
+
+    // outer checkpoint undoes the committed changes as well
+    ASSERT_TRUE(ai.rollback());
+    EXPECT_TRUE(ai.myFaction.empty());
+    EXPECT_TRUE(ai.npcFaction.empty());
+    EXPECT_EQ(ai.unknownFaction.size(), 2U);
+
+    // without outer checkpoint changes are final
+    ai.checkpoint();
+    ASSERT_TRUE(ai.addFaction(first, ai.myFaction));
+    ASSERT_TRUE(ai.commit());
+    EXPECT_FALSE(ai.rollback());
+    EXPECT_EQ(ai.myFaction.count(first), 1U);
+}
+
+TEST(AIState, forkOwnsGadgets) {
+    AIState ai;
+    auto gadget = addCharacterGadget(ai, GadgetEnum::HAIRDRYER, 2, spy::util::UUID::generate());
+    ai.checkpoint();
+
+    auto copy = ai.fork();
+    EXPECT_EQ(copy.getNumberOfCheckpoints(), 0U);
+    ASSERT_EQ(copy.characterGadgets.size(), 1U);
+    copy.characterGadgets.begin()->first->setUsagesLeft(0);
+    EXPECT_EQ(gadget->getUsagesLeft(), 2U);
+}
+
+namespace {
+    struct ChickenFeedTest : public ::testing::Test {
+        spy::util::UUID executor = spy::util::UUID::generate();
+        spy::util::UUID target = spy::util::UUID::generate();
+        spy::gameplay::State state;
+        AIState ai;
+
+        void SetUp() override {
+            spy::character::Character executorCharacter(executor, "Executor");
+            executorCharacter.setCoordinates(spy::util::Point{1, 1});
+            spy::character::Character targetCharacter(target, "Target");
+            targetCharacter.setCoordinates(spy::util::Point{2, 1});
+            state.getCharacters().insert(executorCharacter);
+            state.getCharacters().insert(targetCharacter);
+            ai.unknownFaction[target] = {};
+        }
+
+        void feed(bool successful) {
+            spy::gameplay::GadgetAction action(successful, spy::util::Point{2, 1}, executor,
+                                               GadgetEnum::CHICKEN_FEED);
+            ai.processOperation(action, state, spy::MatchConfig{}, spy::character::FactionEnum::PLAYER1);
+        }
+    };
+}
+
+TEST_F(ChickenFeedTest, failedFeedOfEnemy) {
+    ai.unknownFaction.erase(executor);
+    ai.enemyFaction.insert(executor);
+    feed(false);
+
+    // target can be an npc or a character of the enemy
+    EXPECT_TRUE(ai.npcFaction.empty());
+    ASSERT_EQ(ai.unknownFaction.count(target), 1U);
+    EXPECT_EQ(ai.excludedFactions[target], std::set<spy::character::FactionEnum>{
+            spy::character::FactionEnum::PLAYER1});
+}
+
+TEST_F(ChickenFeedTest, failedFeedOfMine) {
+    ai.myFaction.insert(executor);
+    feed(false);
+    EXPECT_EQ(ai.npcFaction.count(target), 1U);
+}
+
+TEST_F(ChickenFeedTest, failedFeedOfUnknown) {
+    ai.unknownFaction[executor] = {};
+    feed(false);
+    EXPECT_TRUE(ai.npcFaction.empty());
+    EXPECT_EQ(ai.unknownFaction.count(target), 1U);
+    EXPECT_EQ(ai.excludedFactions.count(target), 0U);
+}
+
+TEST_F(ChickenFeedTest, successfulFeed) {
+    ai.myFaction.insert(executor);
+    feed(true);
+    EXPECT_EQ(ai.enemyFaction.count(target), 1U);
+}
@@ -0,0 +1,82 @@
+/**
+ * @file   AllocationCounterTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the per thread allocation counters (test executable links LibClientAllocHook).
+ */
+
+#include <gtest/gtest.h>
+#include <array>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <util/AllocationCounter.hpp>
+
+using libclient::util::AllocationCount;
+using libclient::util::AllocationCounter;
+using libclient::util::AllocationRegistry;
+using libclient::util::AllocationScope;
+using libclient::util::AllocationStatistics;
+
+TEST(AllocationCounter, countsCallingThread) {
+    ASSERT_TRUE(AllocationCounter::isAvailable());
+
+    AllocationScope scope;
+    EXPECT_EQ(scope.get().allocations, 0U);
+    auto value = std::make_unique<std::array<char, 100>>();
+    auto values = std::make_unique<int[]>(10);
+    auto count = scope.get();
+    EXPECT_EQ(count.allocations, 2U);
+    EXPECT_EQ(count.bytes, 100 + 10 * sizeof(int));
+
+    // allocations of other threads are not counted
+    AllocationCount other;
+    std::thread worker([&other]() {
+        AllocationScope workerScope;
+        std::vector<int> v(50);
+        other = workerScope.get();
+    });
+    AllocationScope joinScope;
+    worker.join();
+    EXPECT_EQ(other.allocations, 1U);
+    EXPECT_EQ(other.bytes, 50 * sizeof(int));
+    EXPECT_EQ(joinScope.get().allocations, 0U);
+}
+
+TEST(AllocationCounter, statistics) {
+    AllocationStatistics statistics;
+    statistics.record(AllocationCount{3, 100});
+    statistics.record(AllocationCount{5, 40});
+    EXPECT_EQ(statistics.calls, 2U);
+    EXPECT_EQ(statistics.total.allocations, 8U);
+    EXPECT_EQ(statistics.total.bytes, 140U);
+    // maximized independently
+    EXPECT_EQ(statistics.max.allocations, 5U);
+    EXPECT_EQ(statistics.max.bytes, 100U);
+}
+
+TEST(AllocationCounter, registry) {
+    AllocationRegistry<std::string> registry;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&registry]() {
+            for (int i = 0; i < 100; i++) {
+                registry.record("status", AllocationCount{1, 8});
+            }
+        });
+    }
+    for (auto &thread: threads) {
+        thread.join();
+    }
+    registry.record("hello", AllocationCount{2, 16});
+
+    auto statistics = registry.get();
+    ASSERT_EQ(statistics.size(), 2U);
+    EXPECT_EQ(statistics.at("status").calls, 400U);
+    EXPECT_EQ(statistics.at("status").total.bytes, 3200U);
+    EXPECT_EQ(statistics.at("hello").max.allocations, 2U);
+
+    registry.clear();
+    EXPECT_TRUE(registry.get().empty());
+}
@@ -0,0 +1,109 @@
+/**
+ * @file   BitsetTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the dynamic bitset used for the bitboards.
+ */
+
+#include <gtest/gtest.h>
+#include <util/Bitset.hpp>
+
+using libclient::util::Bitset;
+
+namespace {
+    std::vector<std::size_t> toIndices(const Bitset &b) {
+        std::vector<std::size_t> indices;
+        b.forEach([&indices](std::size_t i) {
+            indices.push_back(i);
+        });
+        return indices;
+    }
+}
+
+TEST(Bitset, setAndCount) {
+    Bitset b(130);
+    EXPECT_EQ(b.size(), 130U);
+    EXPECT_TRUE(b.none());
+
+    b.set(0);
+    b.set(64);
+    b.set(129);
+    EXPECT_TRUE(b.test(64));
+    EXPECT_FALSE(b.test(63));
+    EXPECT_EQ(b.count(), 3U);
+    EXPECT_EQ(toIndices(b), (std::vector<std::size_t>{0, 64, 129}));
+
+    b.reset(64);
+    EXPECT_EQ(b.count(), 2U);
+    b.clear();
+    EXPECT_TRUE(b.none());
+}
+
+TEST(Bitset, shiftLeftAcrossWords) {
+    Bitset b(130);
+    b.set(0);
+    b.set(63);
+    b.set(127);
+    b.set(129);
+
+    // bits crossing word boundaries move into the next word, bits behind size() are dropped
+    EXPECT_EQ(toIndices(b << 1), (std::vector<std::size_t>{1, 64, 128}));
+    EXPECT_EQ(toIndices(b << 64), (std::vector<std::size_t>{64, 127}));
+    EXPECT_EQ(toIndices(b << 65), (std::vector<std::size_t>{65, 128}));
+    EXPECT_TRUE((b << 130).none());
+    EXPECT_EQ((b << 0), b);
+}
+
+TEST(Bitset, shiftRightAcrossWords) {
+    Bitset b(130);
+    b.set(0);
+    b.set(64);
+    b.set(128);
+    b.set(129);
+
+    EXPECT_EQ(toIndices(b >> 1), (std::vector<std::size_t>{63, 127, 128}));
+    EXPECT_EQ(toIndices(b >> 64), (std::vector<std::size_t>{0, 64, 65}));
+    EXPECT_EQ(toIndices(b >> 66), (std::vector<std::size_t>{62, 63}));
+    EXPECT_TRUE((b >> 130).none());
+}
+
+TEST(Bitset, neighboursOnGrid) {
+    // 5 x 3 grid, same shifts and column masks as Bitboards::expand
+    const std::size_t width = 5;
+    const std::size_t height = 3;
+    Bitset notFirstColumn(width * height);
+    Bitset notLastColumn(width * height);
+    for (std::size_t i = 0; i < width * height; i++) {
+        notFirstColumn.set(i, i % width != 0);
+        notLastColumn.set(i, i % width != width - 1);
+    }
+    auto expand = [&](const Bitset &fields) {
+        auto horizontal = fields | ((fields << 1) & notFirstColumn) | ((fields >> 1) & notLastColumn);
+        return horizontal | (horizontal << width) | (horizontal >> width);
+    };
+
+    // right edge of the first row must not wrap to the left edge of the second row
+    Bitset corner(width * height);
+    corner.set(4);
+    EXPECT_EQ(toIndices(expand(corner)), (std::vector<std::size_t>{3, 4, 8, 9}));
+
+    Bitset center(width * height);
+    center.set(7);
+    EXPECT_EQ(expand(center).count(), 9U);
+    EXPECT_FALSE(expand(center).test(10));
+}
+
+TEST(Bitset, setOperations) {
+    Bitset a(70);
+    Bitset b(70);
+    a.set(1);
+    a.set(69);
+    b.set(69);
+    b.set(2);
+
+    EXPECT_EQ(toIndices(a & b), (std::vector<std::size_t>{69}));
+    EXPECT_EQ(toIndices(a | b), (std::vector<std::size_t>{1, 2, 69}));
+    a.subtract(b);
+    EXPECT_EQ(toIndices(a), (std::vector<std::size_t>{1}));
+    EXPECT_NE(a, b);
+}
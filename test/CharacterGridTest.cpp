@@ -0,0 +1,81 @@
+/**
+ * @file   CharacterGridTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the occupancy grid of characters.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <model/CharacterGrid.hpp>
+
+using libclient::model::CharacterGrid;
+using spy::scenario::FieldStateEnum;
+using spy::util::Point;
+
+namespace {
+    struct CharacterGridTest : public ::testing::Test {
+        spy::gameplay::State state;
+        std::vector<spy::util::UUID> ids;
+
+        void SetUp() override {
+            using spy::scenario::Field;
+            std::vector<std::vector<Field>> rows(4, std::vector<Field>(5, Field(FieldStateEnum::FREE)));
+            state.getMap() = spy::scenario::FieldMap(rows);
+
+            // last character is not on the map
+            for (const auto &position: std::vector<std::optional<Point>>{Point{0, 0}, Point{2, 1}, Point{4, 3},
+                                                                          std::nullopt}) {
+                ids.push_back(spy::util::UUID::generate());
+                spy::character::Character character(ids.back(), "Character");
+                if (position.has_value()) {
+                    character.setCoordinates(position.value());
+                }
+                state.getCharacters().insert(character);
+            }
+        }
+    };
+}
+
+TEST_F(CharacterGridTest, lookup) {
+    CharacterGrid grid;
+    EXPECT_FALSE(grid.isBuilt());
+    EXPECT_FALSE(grid.getCharacterAt(Point{0, 0}).has_value());
+
+    grid.build(state);
+    ASSERT_TRUE(grid.isBuilt());
+    EXPECT_EQ(grid.getCharacterAt(Point{2, 1}), ids[1]);
+    EXPECT_EQ(grid.getCharacterAt(Point{4, 3}), ids[2]);
+    EXPECT_FALSE(grid.getCharacterAt(Point{1, 1}).has_value());
+    EXPECT_FALSE(grid.getIndex(Point{5, 0}).has_value());
+    EXPECT_FALSE(grid.getIndex(Point{0, -1}).has_value());
+}
+
+TEST_F(CharacterGridTest, findMatchesLinearSearch) {
+    CharacterGrid grid;
+    grid.build(state);
+    const auto &characters = state.getCharacters();
+    for (int y = 0; y < 4; y++) {
+        for (int x = 0; x < 5; x++) {
+            Point p{x, y};
+            auto linear = std::find_if(characters.begin(), characters.end(), [&p](const auto &c) {
+                return c.getCoordinates().has_value() && c.getCoordinates().value() == p;
+            });
+            EXPECT_TRUE(grid.find(characters, p) == linear);
+        }
+    }
+}
+
+TEST_F(CharacterGridTest, charactersInRange) {
+    CharacterGrid grid;
+    grid.build(state);
+
+    auto near = grid.getCharactersInRange(Point{1, 1}, 1);
+    std::sort(near.begin(), near.end());
+    auto expected = std::vector<spy::util::UUID>{ids[0], ids[1]};
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(near, expected);
+
+    EXPECT_EQ(grid.getCharactersInRange(Point{4, 3}, 0), std::vector<spy::util::UUID>{ids[2]});
+    EXPECT_EQ(grid.getCharactersInRange(Point{0, 0}, 10).size(), 3U);
+}
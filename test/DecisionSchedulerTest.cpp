@@ -0,0 +1,79 @@
+/**
+ * @file   DecisionSchedulerTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the anytime result and the decision scheduler without a running match.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <DecisionScheduler.hpp>
+#include <LibClient.hpp>
+
+using libclient::AnytimeResult;
+using libclient::DecisionScheduler;
+
+TEST(AnytimeResult, keepsBestProposal) {
+    AnytimeResult result;
+    EXPECT_EQ(result.getBest(), nullptr);
+
+    auto first = std::make_shared<spy::gameplay::BaseOperation>();
+    auto second = std::make_shared<spy::gameplay::BaseOperation>();
+    result.propose(first, 0.2);
+    result.propose(second, 0.1);
+    EXPECT_EQ(result.getBest(), first);
+    result.propose(second, 0.3);
+    EXPECT_EQ(result.getBest(), second);
+
+    // nullptr is ignored
+    result.propose(nullptr, 1);
+    EXPECT_EQ(result.getBest(), second);
+    EXPECT_EQ(result.getNumberOfProposals(), 3U);
+}
+
+TEST(AnytimeResult, concurrentProposals) {
+    AnytimeResult result;
+    std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> operations;
+    for (int i = 0; i < 4; i++) {
+        operations.push_back(std::make_shared<spy::gameplay::BaseOperation>());
+    }
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&result, &operations, t]() {
+            for (int i = 0; i < 100; i++) {
+                result.propose(operations[t], t + i / 1000.0);
+            }
+        });
+    }
+    for (auto &thread: threads) {
+        thread.join();
+    }
+    EXPECT_EQ(result.getNumberOfProposals(), 400U);
+    EXPECT_EQ(result.getBest(), operations[3]);
+}
+
+TEST(DecisionScheduler, nothingRequested) {
+    libclient::LibClient client(nullptr);
+    DecisionScheduler scheduler(client, 2);
+    std::atomic<int> calls{0};
+    scheduler.addEvaluator([&calls](const std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> &,
+                                    AnytimeResult &, const std::atomic<bool> &) {
+        calls++;
+    });
+
+    {
+        auto lock = client.network.lockModel();
+        EXPECT_FALSE(scheduler.getDeadline().has_value());
+    }
+
+    // without legal operations no evaluator runs and nothing is sent
+    scheduler.setFallbackBudget(std::chrono::milliseconds(10));
+    scheduler.onRequestGameOperation();
+    scheduler.cancel();
+    EXPECT_EQ(calls, 0);
+    EXPECT_TRUE(scheduler.getDecisionLog().empty());
+
+    // cancel without request is a no-op
+    scheduler.cancel();
+}
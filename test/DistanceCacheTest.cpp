@@ -0,0 +1,131 @@
+/**
+ * @file   DistanceCacheTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the all pairs distance cache and its patching for destroyed walls.
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include <model/DistanceCache.hpp>
+
+using libclient::model::DistanceCache;
+using spy::scenario::FieldStateEnum;
+using spy::util::Point;
+
+namespace {
+    using Level = std::vector<std::vector<FieldStateEnum>>;
+
+    spy::gameplay::State makeState(const Level &level) {
+        std::vector<std::vector<spy::scenario::Field>> rows;
+        for (const auto &row: level) {
+            rows.emplace_back();
+            for (auto state: row) {
+                rows.back().emplace_back(state);
+            }
+        }
+        spy::gameplay::State s;
+        s.getMap() = spy::scenario::FieldMap(rows);
+        return s;
+    }
+
+    /**
+     * compares distances of all pairs and checks that every next step starts a shortest path
+     */
+    void expectSameDistances(const DistanceCache &patched, const DistanceCache &rebuilt, const Level &level) {
+        const auto height = static_cast<int>(level.size());
+        const auto width = static_cast<int>(level.front().size());
+        for (int a = 0; a < width * height; a++) {
+            for (int b = 0; b < width * height; b++) {
+                Point from{a % width, a / width};
+                Point to{b % width, b / width};
+                auto distance = rebuilt.getDistance(from, to);
+                ASSERT_EQ(patched.getDistance(from, to), distance);
+                auto next = patched.getNextStep(from, to);
+                if (!distance.has_value() || distance.value() == 0) {
+                    EXPECT_FALSE(next.has_value());
+                    continue;
+                }
+                ASSERT_TRUE(next.has_value());
+                EXPECT_LE(std::max(std::abs(next->x - from.x), std::abs(next->y - from.y)), 1);
+                EXPECT_EQ(rebuilt.getDistance(next.value(), to), distance.value() - 1);
+            }
+        }
+    }
+}
+
+TEST(DistanceCache, distancesAndNextSteps) {
+    Level level{{FieldStateEnum::FREE, FieldStateEnum::FREE, FieldStateEnum::FREE, FieldStateEnum::FREE},
+                {FieldStateEnum::WALL, FieldStateEnum::WALL, FieldStateEnum::BAR_SEAT, FieldStateEnum::FREE},
+                {FieldStateEnum::FREE, FieldStateEnum::FREE, FieldStateEnum::FREE, FieldStateEnum::SAFE}};
+    DistanceCache cache;
+    cache.build(spy::scenario::Scenario(level));
+    ASSERT_TRUE(cache.isReady());
+
+    EXPECT_EQ(cache.getDistance(Point{0, 0}, Point{0, 0}), 0U);
+    EXPECT_EQ(cache.getDistance(Point{0, 0}, Point{2, 2}), 3U);
+    EXPECT_EQ(cache.getNextStep(Point{0, 0}, Point{2, 2}), (Point{1, 0}));
+    // only way to the lower left corner is through the bar seat
+    EXPECT_EQ(cache.getDistance(Point{0, 0}, Point{0, 2}), 4U);
+    EXPECT_FALSE(cache.getDistance(Point{0, 0}, Point{0, 1}).has_value());
+    EXPECT_FALSE(cache.getDistance(Point{0, 0}, Point{3, 2}).has_value());
+    EXPECT_FALSE(cache.getDistance(Point{0, 0}, Point{5, 5}).has_value());
+    EXPECT_EQ(cache.getDistanceToNeighbour(Point{0, 0}, Point{3, 2}), 2U);
+    EXPECT_TRUE(cache.isWalkable(Point{2, 1}));
+    EXPECT_FALSE(cache.isWalkable(Point{3, 2}));
+}
+
+TEST(DistanceCache, patchDestroyedWall) {
+    Level level{{FieldStateEnum::FREE, FieldStateEnum::FREE, FieldStateEnum::FREE},
+                {FieldStateEnum::WALL, FieldStateEnum::WALL, FieldStateEnum::WALL},
+                {FieldStateEnum::FREE, FieldStateEnum::FREE, FieldStateEnum::FREE}};
+    DistanceCache cache;
+    cache.build(spy::scenario::Scenario(level));
+    EXPECT_FALSE(cache.getDistance(Point{0, 0}, Point{0, 2}).has_value());
+    EXPECT_EQ(cache.update(makeState(level)), 0U);
+
+    level[1][1] = FieldStateEnum::FREE;
+    EXPECT_EQ(cache.update(makeState(level)), 1U);
+    EXPECT_EQ(cache.getDistance(Point{0, 0}, Point{0, 2}), 2U);
+    EXPECT_EQ(cache.getNextStep(Point{0, 0}, Point{0, 2}), (Point{1, 1}));
+
+    DistanceCache rebuilt;
+    rebuilt.build(spy::scenario::Scenario(level));
+    expectSameDistances(cache, rebuilt, level);
+}
+
+TEST(DistanceCache, patchMatchesRebuild) {
+    // random levels, walls are destroyed in several updates
+    std::mt19937 rng(17);
+    for (int round = 0; round < 10; round++) {
+        const int width = 7;
+        const int height = 6;
+        Level level(height, std::vector<FieldStateEnum>(width, FieldStateEnum::FREE));
+        std::vector<Point> walls;
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                auto r = rng() % 10;
+                if (r < 4) {
+                    level[y][x] = FieldStateEnum::WALL;
+                    walls.push_back(Point{x, y});
+                } else if (r == 4) {
+                    level[y][x] = FieldStateEnum::BAR_TABLE;
+                }
+            }
+        }
+
+        DistanceCache cache;
+        cache.build(spy::scenario::Scenario(level), round % 2 == 0);
+        std::shuffle(walls.begin(), walls.end(), rng);
+        for (std::size_t i = 0; i < walls.size() / 2; i++) {
+            level[walls[i].y][walls[i].x] = FieldStateEnum::FREE;
+            if (i % 3 == 2 || i + 1 == walls.size() / 2) {
+                cache.update(makeState(level));
+            }
+        }
+
+        DistanceCache rebuilt;
+        rebuilt.build(spy::scenario::Scenario(level));
+        expectSameDistances(cache, rebuilt, level);
+    }
+}
@@ -0,0 +1,157 @@
+/**
+ * @file   FactionSolverTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the counting of faction assignments.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <model/FactionSolver.hpp>
+
+using libclient::model::FactionCounts;
+using libclient::model::FactionSolver;
+using spy::character::FactionEnum;
+
+namespace {
+    constexpr std::array<FactionEnum, 3> factions = {FactionEnum::PLAYER1, FactionEnum::PLAYER2,
+                                                     FactionEnum::NEUTRAL};
+
+    /**
+     * sums getWeight over all 3^n assignments
+     */
+    double bruteForceTotal(const FactionSolver &solver) {
+        const auto n = solver.getCharacters().size();
+        std::size_t combinations = 1;
+        for (std::size_t i = 0; i < n; i++) {
+            combinations *= 3;
+        }
+        double total = 0;
+        for (std::size_t c = 0; c < combinations; c++) {
+            std::vector<FactionEnum> assignment;
+            for (std::size_t i = 0, rest = c; i < n; i++, rest /= 3) {
+                assignment.push_back(factions[rest % 3]);
+            }
+            total += solver.getWeight(assignment);
+        }
+        return total;
+    }
+}
+
+TEST(FactionSolver, unconstrained) {
+    FactionSolver solver;
+    for (int i = 0; i < 3; i++) {
+        solver.addCharacter(spy::util::UUID::generate());
+    }
+
+    auto solution = solver.solve();
+    ASSERT_TRUE(solution.consistent);
+    EXPECT_DOUBLE_EQ(solution.total, 27);
+    EXPECT_TRUE(solution.forced.empty());
+    for (const auto &m: solution.marginals) {
+        for (auto p: m) {
+            EXPECT_DOUBLE_EQ(p, 1.0 / 3);
+        }
+    }
+}
+
+TEST(FactionSolver, factionSize) {
+    FactionCounts counts;
+    counts.my = {1, 1};
+    FactionSolver solver(counts);
+    std::vector<spy::util::UUID> ids;
+    for (int i = 0; i < 3; i++) {
+        ids.push_back(spy::util::UUID::generate());
+        solver.addCharacter(ids.back());
+    }
+
+    // one of 3 is mine, the others 2 options each
+    auto solution = solver.solve();
+    ASSERT_TRUE(solution.consistent);
+    EXPECT_DOUBLE_EQ(solution.total, 12);
+    EXPECT_DOUBLE_EQ(solution.getProbability(ids[0], FactionEnum::PLAYER1).value(), 1.0 / 3);
+    EXPECT_DOUBLE_EQ(solution.getProbability(ids[0], FactionEnum::NEUTRAL).value(), 1.0 / 3);
+
+    // fixing the only member of my faction excludes it for all others
+    solver.setFaction(ids[0], FactionEnum::PLAYER1);
+    solution = solver.solve();
+    ASSERT_TRUE(solution.consistent);
+    EXPECT_DOUBLE_EQ(solution.total, 4);
+    EXPECT_DOUBLE_EQ(solution.getProbability(ids[1], FactionEnum::PLAYER1).value(), 0);
+    EXPECT_DOUBLE_EQ(solution.getProbability(ids[1], FactionEnum::PLAYER2).value(), 0.5);
+    ASSERT_EQ(solution.forced.size(), 1U);
+    EXPECT_EQ(solution.forced.front().first, ids[0]);
+    EXPECT_EQ(solution.forced.front().second, FactionEnum::PLAYER1);
+}
+
+TEST(FactionSolver, forcedByExclusion) {
+    FactionCounts counts;
+    counts.enemy = {1, 1};
+    FactionSolver solver(counts);
+    auto a = spy::util::UUID::generate();
+    auto b = spy::util::UUID::generate();
+    solver.excludeFaction(a, FactionEnum::PLAYER2);
+    solver.addCharacter(b);
+
+    // the enemy has to be b
+    auto solution = solver.solve();
+    ASSERT_TRUE(solution.consistent);
+    EXPECT_DOUBLE_EQ(solution.total, 2);
+    EXPECT_DOUBLE_EQ(solution.getProbability(b, FactionEnum::PLAYER2).value(), 1);
+    ASSERT_EQ(solution.forced.size(), 1U);
+    EXPECT_EQ(solution.forced.front().first, b);
+}
+
+TEST(FactionSolver, inconsistent) {
+    FactionCounts counts;
+    counts.npc = {2, 2};
+    FactionSolver solver(counts);
+    auto a = spy::util::UUID::generate();
+    solver.setFaction(a, FactionEnum::PLAYER1);
+
+    auto solution = solver.solve();
+    EXPECT_FALSE(solution.consistent);
+    EXPECT_FALSE(solution.getProbability(a, FactionEnum::PLAYER1).has_value());
+    EXPECT_FALSE(solver.sample([]() { return 0.5; }).has_value());
+}
+
+TEST(FactionSolver, matchesBruteForce) {
+    FactionCounts counts;
+    counts.my = {1, 2};
+    counts.enemy = {2, 2};
+    FactionSolver solver(counts);
+    std::vector<spy::util::UUID> ids;
+    for (int i = 0; i < 6; i++) {
+        ids.push_back(spy::util::UUID::generate());
+        solver.addCharacter(ids.back(), {1, 2, 0.5 + i});
+    }
+    solver.excludeFaction(ids[1], FactionEnum::NEUTRAL);
+    solver.setFaction(ids[4], FactionEnum::PLAYER2);
+
+    auto solution = solver.solve();
+    ASSERT_TRUE(solution.consistent);
+    EXPECT_NEAR(solution.total, bruteForceTotal(solver), 1e-9 * solution.total);
+    for (const auto &m: solution.marginals) {
+        EXPECT_NEAR(m[0] + m[1] + m[2], 1, 1e-12);
+    }
+}
+
+TEST(FactionSolver, sampleRespectsConstraints) {
+    FactionCounts counts;
+    counts.my = {1, 1};
+    FactionSolver solver(counts);
+    for (int i = 0; i < 4; i++) {
+        solver.addCharacter(spy::util::UUID::generate());
+    }
+
+    std::mt19937 generator(17);
+    std::uniform_real_distribution<double> distribution(0, 1);
+    auto table = solver.getSamplingTable();
+    std::vector<FactionEnum> assignment;
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(solver.sample([&]() { return distribution(generator); }, table, assignment));
+        EXPECT_GT(solver.getWeight(assignment), 0);
+        EXPECT_EQ(std::count(assignment.begin(), assignment.end(), FactionEnum::PLAYER1), 1);
+    }
+}
@@ -0,0 +1,79 @@
+/**
+ * @file   GadgetKeysTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the interned gadget keys and the lookup of gadget lists with them.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include <thread>
+#include <model/AIState.hpp>
+#include <util/AllocationCounter.hpp>
+#include <util/GadgetKeys.hpp>
+#include <util/OrderUtils.hpp>
+
+using libclient::util::GadgetKeys;
+using spy::gadget::GadgetEnum;
+
+TEST(GadgetKeys, onePerType) {
+    const auto &types = GadgetKeys::getTypes();
+    ASSERT_EQ(types.size(), GadgetKeys::numberOfGadgetTypes - 1);
+    EXPECT_EQ(std::count(types.begin(), types.end(), GadgetEnum::INVALID), 0);
+    EXPECT_EQ(std::set<GadgetEnum>(types.begin(), types.end()).size(), types.size());
+
+    for (auto type: types) {
+        const auto &key = GadgetKeys::get(type);
+        ASSERT_NE(key, nullptr);
+        EXPECT_EQ(key->getType(), type);
+        EXPECT_EQ(&GadgetKeys::get(type), &key);
+    }
+    EXPECT_EQ(GadgetKeys::get(GadgetEnum(GadgetKeys::numberOfGadgetTypes))->getType(), GadgetEnum::INVALID);
+}
+
+TEST(GadgetKeys, sameKeysInAllThreads) {
+    const auto *key = GadgetKeys::get(GadgetEnum::COCKTAIL).get();
+    const spy::gadget::Gadget *other = nullptr;
+    std::thread worker([&other]() {
+        other = GadgetKeys::get(GadgetEnum::COCKTAIL).get();
+    });
+    worker.join();
+    EXPECT_EQ(other, key);
+}
+
+TEST(GadgetKeys, lookupWithoutAllocation) {
+    std::set<std::shared_ptr<spy::gadget::Gadget>, libclient::util::cmpGadgetPtr> gadgets;
+    gadgets.insert(std::make_shared<spy::gadget::Gadget>(GadgetEnum::HAIRDRYER));
+    gadgets.insert(std::make_shared<spy::gadget::Gadget>(GadgetEnum::COCKTAIL));
+    const auto &key = GadgetKeys::get(GadgetEnum::COCKTAIL);
+    const auto &missing = GadgetKeys::get(GadgetEnum::ROCKET_PEN);
+
+    libclient::util::AllocationScope scope;
+    auto it = gadgets.find(key);
+    auto notFound = gadgets.find(missing);
+    EXPECT_EQ(scope.get().allocations, 0U);
+
+    // found entry is the own (mutable) gadget of the list
+    ASSERT_NE(it, gadgets.end());
+    EXPECT_EQ((*it)->getType(), GadgetEnum::COCKTAIL);
+    EXPECT_NE(it->get(), key.get());
+    EXPECT_EQ(notFound, gadgets.end());
+}
+
+TEST(GadgetKeys, unknownGadgetsOwnTheirGadgets) {
+    libclient::model::AIState ai;
+    ai.addUnknownGadgets();
+    ASSERT_EQ(ai.unknownGadgets.size(), GadgetKeys::getTypes().size());
+    for (const auto &[gadget, candidates]: ai.unknownGadgets) {
+        EXPECT_NE(gadget.get(), GadgetKeys::get(gadget->getType()).get());
+    }
+
+    // types already in the list are kept
+    auto cocktail = ai.unknownGadgets.find(GadgetKeys::get(GadgetEnum::COCKTAIL));
+    ASSERT_NE(cocktail, ai.unknownGadgets.end());
+    auto *kept = cocktail->first.get();
+    ai.addUnknownGadgets();
+    EXPECT_EQ(ai.unknownGadgets.size(), GadgetKeys::getTypes().size());
+    EXPECT_EQ(ai.unknownGadgets.find(GadgetKeys::get(GadgetEnum::COCKTAIL))->first.get(), kept);
+}
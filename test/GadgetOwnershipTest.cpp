@@ -0,0 +1,93 @@
+/**
+ * @file   GadgetOwnershipTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the gadget ownership matrix.
+ */
+
+#include <gtest/gtest.h>
+#include <model/AIState.hpp>
+#include <model/GadgetOwnership.hpp>
+
+using libclient::model::GadgetOwnership;
+using spy::gadget::GadgetEnum;
+
+TEST(GadgetOwnership, columns) {
+    auto a = spy::util::UUID::generate();
+    auto b = spy::util::UUID::generate();
+    GadgetOwnership ownership({a, b});
+
+    EXPECT_EQ(ownership.getNumberOfColumns(), 4U);
+    EXPECT_EQ(ownership.getColumn(b), 1U);
+    EXPECT_FALSE(ownership.getColumn(spy::util::UUID::generate()).has_value());
+    EXPECT_EQ(ownership.getFloorColumn(), 2U);
+    EXPECT_EQ(ownership.getUnassignedColumn(), 3U);
+    EXPECT_FALSE(ownership.hasInformation(GadgetEnum::HAIRDRYER));
+    EXPECT_EQ(ownership.getRow(GadgetEnum::INVALID), nullptr);
+}
+
+TEST(GadgetOwnership, setCertain) {
+    auto a = spy::util::UUID::generate();
+    GadgetOwnership ownership({a});
+
+    ASSERT_TRUE(ownership.setCertain(GadgetEnum::MOLEDIE, ownership.getFloorColumn()));
+    EXPECT_DOUBLE_EQ(ownership.getFloorProbability(GadgetEnum::MOLEDIE).value(), 1);
+    EXPECT_DOUBLE_EQ(ownership.getProbability(a, GadgetEnum::MOLEDIE).value(), 0);
+    EXPECT_FALSE(ownership.setCertain(GadgetEnum::INVALID, 0));
+    EXPECT_FALSE(ownership.setCertain(GadgetEnum::MOLEDIE, ownership.getNumberOfColumns()));
+
+    ASSERT_TRUE(ownership.clearRow(GadgetEnum::MOLEDIE));
+    EXPECT_FALSE(ownership.getFloorProbability(GadgetEnum::MOLEDIE).has_value());
+}
+
+TEST(GadgetOwnership, uncertainCandidateStaysUncertain) {
+    auto a = spy::util::UUID::generate();
+    auto b = spy::util::UUID::generate();
+    GadgetOwnership ownership({a, b});
+
+    ASSERT_TRUE(ownership.setRow(GadgetEnum::DIAMOND_COLLAR, {0.4, 0, 0, 0}));
+    EXPECT_DOUBLE_EQ(ownership.getProbability(a, GadgetEnum::DIAMOND_COLLAR).value(), 0.4);
+    EXPECT_DOUBLE_EQ(ownership.getRow(GadgetEnum::DIAMOND_COLLAR)[ownership.getUnassignedColumn()], 0.6);
+
+    // more than certain in total -> normalized
+    ASSERT_TRUE(ownership.setRow(GadgetEnum::BOWLER_BLADE, {0.9, 0.6, 0, 0}));
+    EXPECT_DOUBLE_EQ(ownership.getProbability(a, GadgetEnum::BOWLER_BLADE).value(), 0.6);
+    EXPECT_DOUBLE_EQ(ownership.getProbability(b, GadgetEnum::BOWLER_BLADE).value(), 0.4);
+    EXPECT_DOUBLE_EQ(ownership.getRow(GadgetEnum::BOWLER_BLADE)[ownership.getUnassignedColumn()], 0);
+
+    // no mass -> no information
+    ASSERT_TRUE(ownership.setRow(GadgetEnum::BOWLER_BLADE, {0, 0, 0, 0}));
+    EXPECT_FALSE(ownership.hasInformation(GadgetEnum::BOWLER_BLADE));
+    EXPECT_FALSE(ownership.setRow(GadgetEnum::BOWLER_BLADE, {1}));
+}
+
+TEST(GadgetOwnership, updateRow) {
+    auto a = spy::util::UUID::generate();
+    auto b = spy::util::UUID::generate();
+    GadgetOwnership ownership({a, b});
+    ownership.setRow(GadgetEnum::GRAPPLE, {0.25, 0.25, 0.25, 0.25});
+
+    ASSERT_TRUE(ownership.updateRow(GadgetEnum::GRAPPLE, {1, 0, 1, 0}));
+    EXPECT_DOUBLE_EQ(ownership.getProbability(a, GadgetEnum::GRAPPLE).value(), 0.5);
+    EXPECT_DOUBLE_EQ(ownership.getProbability(b, GadgetEnum::GRAPPLE).value(), 0);
+    EXPECT_DOUBLE_EQ(ownership.getFloorProbability(GadgetEnum::GRAPPLE).value(), 0.5);
+
+    ASSERT_TRUE(ownership.updateRow(GadgetEnum::GRAPPLE, {0, 0, 0, 0}));
+    EXPECT_FALSE(ownership.hasInformation(GadgetEnum::GRAPPLE));
+}
+
+TEST(GadgetOwnership, fromAIState) {
+    libclient::model::AIState ai;
+    auto a = spy::util::UUID::generate();
+    auto b = spy::util::UUID::generate();
+    ai.properties[a] = {};
+    ai.properties[b] = {};
+    auto collar = std::make_shared<spy::gadget::Gadget>(GadgetEnum::DIAMOND_COLLAR);
+    ai.unknownGadgets[collar] = {{a, {0.4}}};
+
+    // matches hasCharacterGadget instead of making the only candidate certain
+    auto ownership = ai.getGadgetOwnership();
+    EXPECT_DOUBLE_EQ(ownership.getProbability(a, GadgetEnum::DIAMOND_COLLAR).value(), 0.4);
+    EXPECT_DOUBLE_EQ(ownership.getProbability(b, GadgetEnum::DIAMOND_COLLAR).value(), 0);
+    EXPECT_DOUBLE_EQ(ai.hasCharacterGadget(a, GadgetEnum::DIAMOND_COLLAR).value(), 0.4);
+}
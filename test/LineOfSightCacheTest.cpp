@@ -0,0 +1,131 @@
+/**
+ * @file   LineOfSightCacheTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the line of sight cache.
+ */
+
+#include <gtest/gtest.h>
+#include <model/LineOfSightCache.hpp>
+#include <util/GameLogicUtils.hpp>
+
+using libclient::model::LineOfSightCache;
+using spy::scenario::FieldStateEnum;
+using spy::util::Point;
+
+namespace {
+    constexpr int width = 6;
+    constexpr int height = 5;
+
+    struct LineOfSightCacheTest : public ::testing::Test {
+        std::vector<std::vector<FieldStateEnum>> level;
+        spy::gameplay::State state;
+
+        void SetUp() override {
+            level.assign(height, std::vector<FieldStateEnum>(width, FieldStateEnum::FREE));
+            for (auto y: {1, 2, 3}) {
+                level[y][2] = FieldStateEnum::WALL;
+            }
+            level[0][4] = FieldStateEnum::SAFE;
+            setMap();
+        }
+
+        void setMap(std::optional<Point> fog = std::nullopt) {
+            std::vector<std::vector<spy::scenario::Field>> rows;
+            for (const auto &row: level) {
+                rows.emplace_back();
+                for (auto field: row) {
+                    rows.back().emplace_back(field);
+                }
+            }
+            if (fog.has_value()) {
+                rows[fog->y][fog->x].setFoggy(true);
+            }
+            state.getMap() = spy::scenario::FieldMap(rows);
+        }
+
+        void expectSameAsGameLogic(LineOfSightCache &cache) {
+            for (int a = 0; a < width * height; a++) {
+                for (int b = 0; b < width * height; b++) {
+                    Point from{a % width, a / width};
+                    Point to{b % width, b / width};
+                    ASSERT_EQ(cache.isInSight(state, from, to),
+                              spy::util::GameLogicUtils::isInSight(state, from, to));
+                }
+            }
+        }
+    };
+}
+
+TEST_F(LineOfSightCacheTest, sameAsGameLogic) {
+    LineOfSightCache cache;
+    cache.update(state);
+    EXPECT_FALSE(cache.isInSight(state, Point{0, 2}, Point{4, 2}));
+    EXPECT_TRUE(cache.isInSight(state, Point{0, 0}, Point{5, 0}));
+    EXPECT_FALSE(cache.isInSight(state, Point{0, 0}, Point{width, 0}));
+    expectSameAsGameLogic(cache);
+}
+
+TEST_F(LineOfSightCacheTest, raysTracedOnce) {
+    LineOfSightCache cache;
+    cache.update(state);
+    EXPECT_EQ(cache.getNumberOfRayTests(), 0U);
+    cache.isInSight(state, Point{0, 2}, Point{4, 2});
+    EXPECT_EQ(cache.getNumberOfRayTests(), 1U);
+
+    // sight is symmetric, reverse direction is cached as well
+    cache.isInSight(state, Point{4, 2}, Point{0, 2});
+    cache.isInSight(state, Point{0, 2}, Point{4, 2});
+    EXPECT_EQ(cache.getNumberOfRayTests(), 1U);
+    EXPECT_EQ(cache.update(state), 0U);
+    cache.isInSight(state, Point{0, 2}, Point{4, 2});
+    EXPECT_EQ(cache.getNumberOfRayTests(), 1U);
+}
+
+TEST_F(LineOfSightCacheTest, changedWallsAndFog) {
+    LineOfSightCache cache;
+    cache.update(state);
+    expectSameAsGameLogic(cache);
+
+    // destroyed wall opens the view through the middle of the map
+    level[2][2] = FieldStateEnum::FREE;
+    setMap();
+    EXPECT_EQ(cache.update(state), 1U);
+    EXPECT_TRUE(cache.isInSight(state, Point{0, 2}, Point{4, 2}));
+    expectSameAsGameLogic(cache);
+
+    // fog blocks it again
+    setMap(Point{3, 2});
+    EXPECT_EQ(cache.update(state), 1U);
+    EXPECT_FALSE(cache.isInSight(state, Point{0, 2}, Point{4, 2}));
+    expectSameAsGameLogic(cache);
+
+    setMap();
+    EXPECT_EQ(cache.update(state), 1U);
+    expectSameAsGameLogic(cache);
+}
+
+TEST_F(LineOfSightCacheTest, fieldsInSight) {
+    LineOfSightCache cache;
+    cache.update(state);
+
+    auto near = cache.getFieldsInSight(state, Point{0, 0}, 1);
+    EXPECT_EQ(near.size(), 3U);
+    for (const auto &p: near) {
+        EXPECT_LE(std::max(p.x, p.y), 1);
+    }
+
+    auto all = cache.getFieldsInSight(state, Point{0, 2});
+    unsigned int expected = 0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            Point p{x, y};
+            if (p != Point{0, 2} && spy::util::GameLogicUtils::isInSight(state, Point{0, 2}, p)) {
+                expected++;
+            }
+        }
+    }
+    EXPECT_EQ(all.size(), expected);
+    EXPECT_LT(all.size(), static_cast<std::size_t>(width * height - 1));
+    EXPECT_TRUE(cache.getFieldsInSight(state, Point{-1, 0}).empty());
+}
@@ -0,0 +1,81 @@
+/**
+ * @file   MemoryUsageTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the memory accounting of the model.
+ */
+
+#include <gtest/gtest.h>
+#include <datatypes/gameplay/RetireAction.hpp>
+#include <model/MemoryUsage.hpp>
+#include <model/Model.hpp>
+#include <util/MemoryUtils.hpp>
+
+using libclient::model::MemoryUsage;
+using libclient::model::measureMemoryUsage;
+
+TEST(MemoryUsage, totalAndMaximum) {
+    MemoryUsage usage;
+    usage.gameState = 100;
+    usage.operations = 40; // part of gameState
+    usage.aiState = 20;
+    usage.clientState = 3;
+    usage.replay = 7;
+    usage.caches = 5;
+    EXPECT_EQ(usage.getTotal(), 135U);
+
+    MemoryUsage other;
+    other.gameState = 50;
+    other.aiState = 30;
+    other.numberOfOperations = 4;
+    usage.updateMaximum(other);
+    EXPECT_EQ(usage.gameState, 100U);
+    EXPECT_EQ(usage.aiState, 30U);
+    EXPECT_EQ(usage.operations, 40U);
+    EXPECT_EQ(usage.numberOfOperations, 4U);
+}
+
+TEST(MemoryUsage, emptyModel) {
+    libclient::Model model;
+    auto usage = measureMemoryUsage(model);
+    EXPECT_GE(usage.gameState, sizeof(libclient::model::GameState));
+    EXPECT_GE(usage.aiState, sizeof(libclient::model::AIState));
+    EXPECT_GE(usage.clientState, sizeof(libclient::model::ClientState));
+    EXPECT_GT(usage.caches, 0U);
+    EXPECT_EQ(usage.operations, 0U);
+    EXPECT_EQ(usage.replay, 0U);
+    EXPECT_EQ(usage.numberOfOperations, 0U);
+    EXPECT_EQ(usage.numberOfBeliefs, 0U);
+    EXPECT_EQ(usage.numberOfInformation, 0U);
+}
+
+TEST(MemoryUsage, growsWithOperationsAndBeliefs) {
+    libclient::Model model;
+    auto before = measureMemoryUsage(model);
+
+    auto id = spy::util::UUID::generate();
+    model.gameState.operations.reserve(2);
+    for (int i = 0; i < 2; i++) {
+        model.gameState.operations.push_back(
+                std::make_shared<spy::gameplay::RetireAction>(true, spy::util::Point{0, 0}, id));
+    }
+    auto withOperations = measureMemoryUsage(model);
+    EXPECT_EQ(withOperations.numberOfOperations, 2U);
+    EXPECT_EQ(withOperations.operations, 2 * (sizeof(std::shared_ptr<const spy::gameplay::BaseOperation>) +
+                                              libclient::util::sharedControlBlock +
+                                              sizeof(spy::gameplay::RetireAction)));
+    EXPECT_EQ(withOperations.gameState - before.gameState, withOperations.operations);
+    EXPECT_EQ(withOperations.aiState, before.aiState);
+
+    model.aiState.unknownFaction[id] = {{spy::character::FactionEnum::PLAYER1, {0.25, 0.75}}};
+    model.aiState.addUnknownGadgets();
+    model.aiState.unknownGadgets.begin()->second.emplace_back(id, std::vector<double>{0.5});
+    auto withBeliefs = measureMemoryUsage(model);
+    EXPECT_EQ(withBeliefs.numberOfBeliefs, 3U);
+    EXPECT_GT(withBeliefs.aiState, withOperations.aiState);
+
+    model.replay = spy::network::messages::Replay{};
+    model.replaySize = 4096;
+    EXPECT_EQ(measureMemoryUsage(model).replay, 4096U);
+    EXPECT_EQ(measureMemoryUsage(model).getTotal(), withBeliefs.getTotal() + 4096);
+}
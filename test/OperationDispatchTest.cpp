@@ -0,0 +1,74 @@
+/**
+ * @file   OperationDispatchTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the dispatch of operations to handlers of their concrete type.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <util/OperationDispatch.hpp>
+
+using libclient::util::asCharacterOperation;
+using libclient::util::isCharacterOperation;
+using libclient::util::Overloaded;
+using libclient::util::visitOperation;
+using namespace spy::gameplay;
+using spy::util::Point;
+
+namespace {
+    /**
+     * names the handler that was picked
+     */
+    std::string handlerOf(const BaseOperation &operation) {
+        return visitOperation(operation, Overloaded{
+                [](const Movement &) -> std::string { return "movement"; },
+                [](const GadgetAction &) -> std::string { return "gadget"; },
+                [](const CatAction &) -> std::string { return "cat"; },
+                [](const CharacterOperation &) -> std::string { return "character"; },
+                [](const BaseOperation &) -> std::string { return "base"; }
+        });
+    }
+}
+
+TEST(OperationDispatch, mostDerivedHandler) {
+    auto id = spy::util::UUID::generate();
+    EXPECT_EQ(handlerOf(Movement(true, Point{1, 1}, id, Point{0, 0})), "movement");
+    EXPECT_EQ(handlerOf(GadgetAction(true, Point{1, 1}, id, spy::gadget::GadgetEnum::HAIRDRYER)), "gadget");
+    EXPECT_EQ(handlerOf(CatAction(Point{1, 1})), "cat");
+    // no own handler, falls back to base classes
+    EXPECT_EQ(handlerOf(GambleAction(true, Point{1, 1}, id, 10)), "character");
+    EXPECT_EQ(handlerOf(RetireAction(true, Point{1, 1}, id)), "character");
+    EXPECT_EQ(handlerOf(JanitorAction(Point{1, 1})), "base");
+}
+
+TEST(OperationDispatch, handlerSeesConcreteOperation) {
+    auto id = spy::util::UUID::generate();
+    std::shared_ptr<BaseOperation> operation = std::make_shared<Movement>(true, Point{2, 1}, id, Point{1, 1});
+    auto from = visitOperation(*operation, Overloaded{
+            [](const Movement &m) -> std::optional<Point> { return m.getFrom(); },
+            [](const BaseOperation &) -> std::optional<Point> { return std::nullopt; }
+    });
+    EXPECT_EQ(from, (Point{1, 1}));
+
+    // no copies and no reference counting
+    const BaseOperation *seen = nullptr;
+    visitOperation(*operation, [&seen](const auto &o) { seen = &o; });
+    EXPECT_EQ(seen, operation.get());
+    EXPECT_EQ(operation.use_count(), 1);
+}
+
+TEST(OperationDispatch, characterOperations) {
+    auto id = spy::util::UUID::generate();
+    RetireAction retire(true, Point{0, 0}, id);
+    auto character = asCharacterOperation(retire);
+    ASSERT_NE(character, nullptr);
+    EXPECT_EQ(character->getCharacterId(), id);
+    EXPECT_EQ(static_cast<const BaseOperation *>(character), &retire);
+
+    EXPECT_EQ(asCharacterOperation(CatAction(Point{0, 0})), nullptr);
+    EXPECT_EQ(asCharacterOperation(JanitorAction(Point{0, 0})), nullptr);
+    EXPECT_FALSE(isCharacterOperation(OperationEnum::INVALID));
+    EXPECT_TRUE(isCharacterOperation(OperationEnum::EXFILTRATION));
+}
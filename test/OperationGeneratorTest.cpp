@@ -0,0 +1,82 @@
+/**
+ * @file   OperationGeneratorTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the generator of legal operations.
+ */
+
+#include <gtest/gtest.h>
+#include <datatypes/gadgets/Cocktail.hpp>
+#include <datatypes/gameplay/GadgetAction.hpp>
+#include <model/OperationGenerator.hpp>
+
+using libclient::model::OperationGenerator;
+using spy::gadget::GadgetEnum;
+using spy::scenario::FieldStateEnum;
+using spy::util::Point;
+
+namespace {
+    struct OperationGeneratorTest : public ::testing::Test {
+        spy::util::UUID id = spy::util::UUID::generate();
+        libclient::model::GameState game;
+        libclient::model::ClientState client;
+        OperationGenerator generator;
+
+        void SetUp() override {
+            // bar tables at (0, 0) and (1, 0), only the second one holds a cocktail
+            using spy::scenario::Field;
+            std::vector<std::vector<Field>> rows{
+                    {Field(FieldStateEnum::BAR_TABLE), Field(FieldStateEnum::BAR_TABLE), Field(FieldStateEnum::FREE)},
+                    {Field(FieldStateEnum::FREE), Field(FieldStateEnum::FREE), Field(FieldStateEnum::FREE)},
+                    {Field(FieldStateEnum::WALL), Field(FieldStateEnum::WALL), Field(FieldStateEnum::WALL)}};
+            rows[0][1].setGadget(std::make_shared<spy::gadget::Cocktail>());
+            game.state.getMap() = spy::scenario::FieldMap(rows);
+
+            spy::character::Character character(id, "James Bond");
+            character.setCoordinates(Point{1, 1});
+            game.state.getCharacters().insert(character);
+            game.bitboards.update(game.state);
+            game.lineOfSight.update(game.state);
+
+            client.id = spy::util::UUID::generate();
+            client.role = spy::network::RoleEnum::PLAYER;
+            client.activeCharacter = id;
+        }
+
+        std::vector<Point> cocktailTargets() {
+            std::vector<Point> targets;
+            for (const auto &op: generator.generate(game, client)) {
+                auto action = std::dynamic_pointer_cast<spy::gameplay::GadgetAction>(op);
+                if (action != nullptr && action->getGadget() == GadgetEnum::COCKTAIL) {
+                    targets.push_back(action->getTarget());
+                }
+            }
+            return targets;
+        }
+    };
+}
+
+TEST_F(OperationGeneratorTest, takeCocktailWithoutHoldingOne) {
+    EXPECT_EQ(cocktailTargets(), (std::vector<Point>{{1, 0}}));
+}
+
+TEST_F(OperationGeneratorTest, cachedUntilInvalidated) {
+    const auto &operations = generator.generate(game, client);
+    EXPECT_FALSE(operations.empty());
+    auto candidates = generator.getNumberOfCandidates();
+
+    // cocktail taken, but state version unchanged -> cached result
+    game.state.getMap().getField(Point{1, 0}).removeGadget();
+    game.bitboards.update(game.state);
+    EXPECT_EQ(cocktailTargets().size(), 1U);
+    EXPECT_EQ(generator.getNumberOfCandidates(), candidates);
+
+    generator.invalidate();
+    EXPECT_TRUE(cocktailTargets().empty());
+}
+
+TEST_F(OperationGeneratorTest, spectator) {
+    client.role = spy::network::RoleEnum::SPECTATOR;
+    EXPECT_TRUE(generator.generate(game, client).empty());
+    EXPECT_EQ(generator.getNumberOfCandidates(), 0U);
+}
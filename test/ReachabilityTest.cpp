@@ -0,0 +1,141 @@
+/**
+ * @file   ReachabilityTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the movement reachability sets.
+ */
+
+#include <gtest/gtest.h>
+#include <deque>
+#include <model/Reachability.hpp>
+
+using libclient::model::Bitboards;
+using libclient::model::ReachabilityCache;
+using spy::scenario::FieldStateEnum;
+using spy::util::Point;
+
+namespace {
+    constexpr int width = 6;
+    constexpr int height = 4;
+
+    struct ReachabilityTest : public ::testing::Test {
+        spy::gameplay::State state;
+        Bitboards boards;
+        spy::util::UUID mover = spy::util::UUID::generate();
+        spy::util::UUID blocker = spy::util::UUID::generate();
+        spy::util::UUID absent = spy::util::UUID::generate();
+
+        void SetUp() override {
+            using spy::scenario::Field;
+            std::vector<std::vector<Field>> rows(height, std::vector<Field>(width, Field(FieldStateEnum::FREE)));
+            for (auto y: {0, 1, 2}) {
+                rows[y][3] = Field(FieldStateEnum::WALL);
+            }
+            rows[3][1] = Field(FieldStateEnum::BAR_TABLE);
+            rows[2][1] = Field(FieldStateEnum::BAR_SEAT);
+            state.getMap() = spy::scenario::FieldMap(rows);
+
+            spy::character::Character character(mover, "Mover");
+            character.setCoordinates(Point{0, 0});
+            state.getCharacters().insert(character);
+            spy::character::Character other(blocker, "Blocker");
+            other.setCoordinates(Point{2, 3});
+            state.getCharacters().insert(other);
+            state.getCharacters().insert(spy::character::Character(absent, "Absent"));
+            boards.update(state);
+        }
+
+        /**
+         * breadth first search over walkable fields as reference
+         */
+        std::vector<std::optional<unsigned int>> distancesFrom(const Point &start, bool passOccupied) const {
+            std::vector<std::optional<unsigned int>> distances(width * height);
+            std::deque<Point> queue{start};
+            distances[start.y * width + start.x] = 0;
+            while (!queue.empty()) {
+                auto p = queue.front();
+                queue.pop_front();
+                for (int dy = -1; dy <= 1; dy++) {
+                    for (int dx = -1; dx <= 1; dx++) {
+                        Point n{p.x + dx, p.y + dy};
+                        if (n.x < 0 || n.y < 0 || n.x >= width || n.y >= height ||
+                            distances[n.y * width + n.x].has_value()) {
+                            continue;
+                        }
+                        auto field = state.getMap().getField(n).getFieldState();
+                        bool walkable = field == FieldStateEnum::FREE || field == FieldStateEnum::BAR_SEAT;
+                        if (!walkable || (!passOccupied && n == Point{2, 3})) {
+                            continue;
+                        }
+                        distances[n.y * width + n.x] = distances[p.y * width + p.x].value() + 1;
+                        queue.push_back(n);
+                    }
+                }
+            }
+            return distances;
+        }
+    };
+}
+
+TEST_F(ReachabilityTest, sameAsBreadthFirstSearch) {
+    ReachabilityCache cache;
+    for (auto passOccupied: {true, false}) {
+        auto expected = distancesFrom(Point{0, 0}, passOccupied);
+        for (unsigned int budget = 0; budget <= 8; budget++) {
+            auto result = cache.get(boards, state, mover, budget, passOccupied);
+            ASSERT_NE(result, nullptr);
+            EXPECT_EQ(result->start, (Point{0, 0}));
+            for (int i = 0; i < width * height; i++) {
+                auto index = boards.getIndex(Point{i % width, i / width}).value();
+                auto distance = expected[i];
+                if (distance.has_value() && distance.value() > budget) {
+                    distance.reset();
+                }
+                EXPECT_EQ(result->getDistance(index), distance);
+                EXPECT_EQ(result->reachable.test(index), distance.has_value());
+            }
+        }
+    }
+}
+
+TEST_F(ReachabilityTest, cheapestPath) {
+    ReachabilityCache cache;
+    auto result = cache.get(boards, state, mover, 10, false);
+    ASSERT_NE(result, nullptr);
+
+    // around the wall, the occupied field below it can not be entered
+    auto target = Point{4, 0};
+    auto path = result->getPath(boards, target);
+    ASSERT_TRUE(path.has_value());
+    ASSERT_EQ(path->size(), result->getDistance(boards.getIndex(target).value()).value());
+    EXPECT_EQ(path->back(), target);
+    auto previous = result->start;
+    for (const auto &p: path.value()) {
+        EXPECT_EQ(std::max(std::abs(p.x - previous.x), std::abs(p.y - previous.y)), 1);
+        EXPECT_TRUE(boards.getWalkable().test(boards.getIndex(p).value()));
+        EXPECT_NE(p, (Point{2, 3}));
+        previous = p;
+    }
+
+    EXPECT_TRUE(result->getPath(boards, Point{0, 0})->empty());
+    EXPECT_FALSE(result->getPath(boards, Point{3, 0}).has_value());
+    EXPECT_FALSE(result->getPath(boards, Point{width, 0}).has_value());
+}
+
+TEST_F(ReachabilityTest, cachedUntilCleared) {
+    ReachabilityCache cache;
+    EXPECT_EQ(cache.get(boards, state, absent, 2), nullptr);
+
+    auto first = cache.get(boards, state, mover, 2);
+    EXPECT_EQ(cache.get(boards, state, mover, 2), first);
+    EXPECT_NE(cache.get(boards, state, mover, 3), first);
+    EXPECT_NE(cache.get(boards, state, mover, 2, false), first);
+    EXPECT_GT(cache.getSizeInBytes(), 0U);
+
+    // result stays valid after clearing
+    cache.clear();
+    EXPECT_EQ(cache.getSizeInBytes(), 0U);
+    auto second = cache.get(boards, state, mover, 2);
+    EXPECT_NE(second, first);
+    EXPECT_EQ(second->reachable, first->reachable);
+}
@@ -0,0 +1,96 @@
+/**
+ * @file   RootBanditSearchTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the parallel bandit over the legal operations.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <datatypes/gameplay/GambleAction.hpp>
+#include <datatypes/gameplay/RetireAction.hpp>
+#include <model/RootBanditSearch.hpp>
+
+using libclient::model::AIState;
+using libclient::model::Determinization;
+using libclient::model::RootBanditSearch;
+using libclient::model::Simulator;
+using spy::character::FactionEnum;
+
+namespace {
+    struct RootBanditSearchTest : public ::testing::Test {
+        spy::util::UUID id = spy::util::UUID::generate();
+        spy::util::UUID other = spy::util::UUID::generate();
+        spy::util::Point position{1, 2};
+        spy::gameplay::State state;
+        AIState ai;
+        std::vector<std::shared_ptr<spy::gameplay::BaseOperation>> operations;
+
+        void SetUp() override {
+            spy::character::Character character(id, "James Bond");
+            character.setCoordinates(position);
+            character.setMovePoints(2);
+            character.setActionPoints(2);
+            state.getCharacters().insert(character);
+            spy::character::Character otherCharacter(other, "Other");
+            otherCharacter.setCoordinates(spy::util::Point{3, 3});
+            state.getCharacters().insert(otherCharacter);
+            ai.properties[id] = {};
+            ai.properties[other] = {};
+            ai.myFaction.insert(id);
+            ai.unknownFaction[other] = {};
+
+            operations.push_back(std::make_shared<spy::gameplay::RetireAction>(false, position, id));
+            operations.push_back(std::make_shared<spy::gameplay::GambleAction>(false, position, id, 5));
+        }
+
+        static std::chrono::steady_clock::time_point in(std::chrono::milliseconds duration) {
+            return std::chrono::steady_clock::now() + duration;
+        }
+    };
+}
+
+TEST_F(RootBanditSearchTest, prefersBetterOperation) {
+    // action points left after the operation
+    RootBanditSearch search([this](const Simulator &simulator, const Determinization &) {
+        return simulator.getState().getCharacters().findByUUID(id)->getActionPoints() / 2.0;
+    }, 2, 1);
+
+    auto result = search.search(operations, state, ai, spy::MatchConfig{}, FactionEnum::PLAYER1,
+                                in(std::chrono::milliseconds(50)));
+    ASSERT_EQ(result.best, operations[1]);
+    EXPECT_DOUBLE_EQ(result.values[0], 0);
+    EXPECT_DOUBLE_EQ(result.values[1], 0.5);
+    EXPECT_GT(result.visits[1], result.visits[0]);
+    EXPECT_EQ(search.getStatistics().threads, 2U);
+    EXPECT_EQ(search.getStatistics().iterations, result.visits[0] + result.visits[1]);
+}
+
+TEST_F(RootBanditSearchTest, determinizationIsAssumed) {
+    std::atomic<std::size_t> unknown{0};
+    std::atomic<std::size_t> evaluations{0};
+    RootBanditSearch search([&](const Simulator &simulator, const Determinization &) {
+        evaluations++;
+        unknown += simulator.getAIState().unknownFaction.size();
+        return 0.0;
+    }, 2, 1);
+
+    for (int i = 0; i < 2; i++) {
+        search.search(operations, state, ai, spy::MatchConfig{}, FactionEnum::PLAYER1,
+                      in(std::chrono::milliseconds(20)));
+    }
+    EXPECT_GT(evaluations, 0U);
+    EXPECT_EQ(unknown, 0U);
+    // live beliefs are not changed
+    EXPECT_EQ(ai.unknownFaction.size(), 1U);
+}
+
+TEST_F(RootBanditSearchTest, withoutOperations) {
+    RootBanditSearch search([](const Simulator &, const Determinization &) {
+        return 0.0;
+    }, 1, 1);
+    auto result = search.search({}, state, ai, spy::MatchConfig{}, FactionEnum::PLAYER1,
+                                in(std::chrono::milliseconds(10)));
+    EXPECT_EQ(result.best, nullptr);
+    EXPECT_TRUE(result.visits.empty());
+}
@@ -0,0 +1,91 @@
+/**
+ * @file   SafePlannerTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the ranking of safes and npcs.
+ */
+
+#include <gtest/gtest.h>
+#include <model/SafePlanner.hpp>
+
+using libclient::model::AIState;
+using libclient::model::SafePlanner;
+using spy::scenario::FieldStateEnum;
+using spy::util::Point;
+
+namespace {
+    struct SafePlannerTest : public ::testing::Test {
+        spy::util::UUID mine = spy::util::UUID::generate();
+        spy::gameplay::State state;
+        AIState ai;
+        SafePlanner planner;
+
+        void SetUp() override {
+            // safes at x = 0, 3 and 6 of a single row
+            std::vector<spy::scenario::Field> row(7, spy::scenario::Field(FieldStateEnum::FREE));
+            for (auto x: {0, 3, 6}) {
+                row[x] = spy::scenario::Field(FieldStateEnum::SAFE);
+            }
+            ai.safes.build(spy::scenario::FieldMap({row}));
+
+            spy::character::Character character(mine, "James Bond");
+            character.setCoordinates(Point{1, 0});
+            state.getCharacters().insert(character);
+            ai.myFaction.insert(mine);
+        }
+    };
+}
+
+TEST_F(SafePlannerTest, closestSafeFirst) {
+    ai.safeCombinations = {1};
+    const auto &plan = planner.plan(ai, state, spy::MatchConfig{});
+
+    ASSERT_EQ(plan.safes.size(), 3U);
+    EXPECT_EQ(plan.safes[0].position, (Point{0, 0}));
+    EXPECT_EQ(plan.safes[0].distance, 0U);
+    EXPECT_EQ(plan.safes[0].closestCharacter, mine);
+    EXPECT_DOUBLE_EQ(plan.safes[0].successChance, 1.0 / 3);
+    EXPECT_EQ(plan.safes[1].position, (Point{3, 0}));
+    EXPECT_EQ(plan.safes[2].position, (Point{6, 0}));
+}
+
+TEST_F(SafePlannerTest, unreachableSafesOmitted) {
+    ai.safeCombinations = {1};
+    // safe next to the character is behind a wall
+    planner.setDistanceFunction([](const Point &from, const Point &target) -> std::optional<unsigned int> {
+        if (target.x == 0) {
+            return std::nullopt;
+        }
+        return static_cast<unsigned int>(std::abs(target.x - from.x) - 1);
+    });
+    const auto &plan = planner.plan(ai, state, spy::MatchConfig{});
+
+    ASSERT_EQ(plan.safes.size(), 2U);
+    EXPECT_EQ(plan.safes[0].position, (Point{3, 0}));
+    EXPECT_EQ(plan.safes[1].position, (Point{6, 0}));
+}
+
+TEST_F(SafePlannerTest, withoutOwnCharacter) {
+    ai.safeCombinations = {1};
+    ai.myFaction.clear();
+    ai.npcFaction.insert(mine);
+    const auto &plan = planner.plan(ai, state, spy::MatchConfig{});
+    EXPECT_TRUE(plan.safes.empty());
+    EXPECT_GT(plan.combinationValue, 0);
+}
+
+TEST_F(SafePlannerTest, triedAndOpenedSafes) {
+    ai.safeCombinations = {1};
+    ai.triedSafes[0] = 1; // tried without success, no combination learned since
+    ai.safes.markOpened(1, true);
+    const auto &plan = planner.plan(ai, state, spy::MatchConfig{});
+    ASSERT_EQ(plan.safes.size(), 1U);
+    EXPECT_EQ(plan.safes[0].position, (Point{6, 0}));
+
+    // new combination makes the tried safe worth another try, cached plan is recomputed
+    ai.safeCombinations.insert(2);
+    const auto &updated = planner.plan(ai, state, spy::MatchConfig{});
+    ASSERT_EQ(updated.safes.size(), 2U);
+    EXPECT_EQ(updated.safes[0].position, (Point{0, 0}));
+    EXPECT_DOUBLE_EQ(updated.safes[0].successChance, 0.5);
+}
@@ -0,0 +1,65 @@
+/**
+ * @file   SafeRegistryTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the registry of safes.
+ */
+
+#include <gtest/gtest.h>
+#include <model/SafeRegistry.hpp>
+
+using libclient::model::SafeRegistry;
+using spy::scenario::FieldStateEnum;
+using spy::util::Point;
+
+namespace {
+    spy::scenario::FieldMap makeMap() {
+        // rows of different length
+        using spy::scenario::Field;
+        return spy::scenario::FieldMap({{Field(FieldStateEnum::SAFE), Field(FieldStateEnum::FREE),
+                                         Field(FieldStateEnum::SAFE)},
+                                        {Field(FieldStateEnum::FREE)},
+                                        {Field(FieldStateEnum::WALL), Field(FieldStateEnum::SAFE)}});
+    }
+}
+
+TEST(SafeRegistry, indicesRowMajor) {
+    SafeRegistry registry;
+    EXPECT_FALSE(registry.isBuilt());
+    registry.build(makeMap());
+    ASSERT_TRUE(registry.isBuilt());
+
+    ASSERT_EQ(registry.getNumberOfSafes(), 3U);
+    EXPECT_EQ(registry.getIndex(Point{0, 0}), 0U);
+    EXPECT_EQ(registry.getIndex(Point{2, 0}), 1U);
+    EXPECT_EQ(registry.getIndex(Point{1, 2}), 2U);
+    EXPECT_EQ(registry.getPosition(2), (Point{1, 2}));
+
+    EXPECT_FALSE(registry.getIndex(Point{1, 0}).has_value());
+    EXPECT_FALSE(registry.getIndex(Point{2, 1}).has_value()); // missing field of short row
+    EXPECT_FALSE(registry.getIndex(Point{-1, 0}).has_value());
+    EXPECT_FALSE(registry.getIndex(Point{0, 3}).has_value());
+}
+
+TEST(SafeRegistry, openedSafes) {
+    SafeRegistry registry;
+    registry.build(makeMap());
+    EXPECT_EQ(registry.getNumberOfOpenableSafes(), 3U);
+
+    registry.markOpened(0, true);
+    registry.markOpened(2, false);
+    EXPECT_TRUE(registry.isOpened(0));
+    EXPECT_TRUE(registry.isOpened(2));
+    EXPECT_FALSE(registry.isOpened(1));
+    EXPECT_FALSE(registry.isOpenable(0));
+    // opened by the enemy, the combination may still be found
+    EXPECT_TRUE(registry.isOpenable(2));
+    EXPECT_FALSE(registry.isOpenable(3));
+    EXPECT_EQ(registry.getNumberOfOpenableSafes(), 2U);
+    EXPECT_EQ(registry.getOpenedByMe().count(), 1U);
+    EXPECT_EQ(registry.getOpenedTotal().count(), 2U);
+
+    // rebuilding forgets opened safes
+    registry.build(makeMap());
+    EXPECT_EQ(registry.getOpenedTotal().count(), 0U);
+}
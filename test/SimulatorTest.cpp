@@ -0,0 +1,131 @@
+/**
+ * @file   SimulatorTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of apply and undo of the forward simulation.
+ */
+
+#include <gtest/gtest.h>
+#include <datatypes/gameplay/GambleAction.hpp>
+#include <datatypes/gameplay/RetireAction.hpp>
+#include <model/Simulator.hpp>
+
+using libclient::model::AIState;
+using libclient::model::Simulator;
+using spy::character::FactionEnum;
+
+namespace {
+    struct SimulatorTest : public ::testing::Test {
+        spy::util::UUID id = spy::util::UUID::generate();
+        spy::util::Point position{1, 2};
+        spy::gameplay::State state;
+        AIState ai;
+
+        void SetUp() override {
+            spy::character::Character character(id, "James Bond");
+            character.setCoordinates(position);
+            character.setMovePoints(2);
+            character.setActionPoints(2);
+            state.getCharacters().insert(character);
+            ai.myFaction.insert(id);
+        }
+
+        static const spy::character::Character &getCharacter(const Simulator &simulator,
+                                                             const spy::util::UUID &characterId) {
+            return *simulator.getState().getCharacters().findByUUID(characterId);
+        }
+    };
+}
+
+TEST_F(SimulatorTest, applyAndUndo) {
+    Simulator simulator(state, ai, spy::MatchConfig{}, FactionEnum::PLAYER1);
+    const auto hash = simulator.getHash();
+
+    auto gamble = std::make_shared<const spy::gameplay::GambleAction>(false, position, id, 5);
+    ASSERT_TRUE(simulator.apply(gamble));
+    EXPECT_EQ(simulator.getDepth(), 1U);
+    EXPECT_EQ(getCharacter(simulator, id).getActionPoints(), 1U);
+    EXPECT_NE(simulator.getHash(), hash);
+
+    auto retire = std::make_shared<const spy::gameplay::RetireAction>(false, position, id);
+    ASSERT_TRUE(simulator.apply(retire));
+    EXPECT_EQ(simulator.getDepth(), 2U);
+    EXPECT_EQ(getCharacter(simulator, id).getMovePoints(), 0U);
+    EXPECT_EQ(getCharacter(simulator, id).getActionPoints(), 0U);
+    const auto retiredHash = simulator.getHash();
+
+    ASSERT_TRUE(simulator.undo());
+    EXPECT_EQ(getCharacter(simulator, id).getMovePoints(), 2U);
+    EXPECT_EQ(getCharacter(simulator, id).getActionPoints(), 1U);
+    EXPECT_NE(simulator.getHash(), retiredHash);
+
+    ASSERT_TRUE(simulator.undo());
+    EXPECT_FALSE(simulator.undo());
+    EXPECT_EQ(simulator.getDepth(), 0U);
+    EXPECT_EQ(getCharacter(simulator, id).getActionPoints(), 2U);
+    EXPECT_EQ(getCharacter(simulator, id).getCoordinates(), position);
+    EXPECT_EQ(simulator.getHash(), hash);
+    EXPECT_EQ(simulator.getAIState().getNumberOfCheckpoints(), 0U);
+}
+
+TEST_F(SimulatorTest, hashIndependentOfPath) {
+    // same points reached by different sequences of operations give the same hash
+    Simulator first(state, ai, spy::MatchConfig{}, FactionEnum::PLAYER1);
+    Simulator second(state, ai, spy::MatchConfig{}, FactionEnum::PLAYER1, first.getKeys());
+
+    auto gamble = std::make_shared<const spy::gameplay::GambleAction>(false, position, id, 5);
+    auto retire = std::make_shared<const spy::gameplay::RetireAction>(false, position, id);
+    ASSERT_TRUE(first.apply(gamble));
+    ASSERT_TRUE(first.apply(retire));
+    ASSERT_TRUE(second.apply(retire));
+    EXPECT_EQ(first.getHash(), second.getHash());
+}
+
+TEST_F(SimulatorTest, unknownCharacter) {
+    Simulator simulator(state, ai, spy::MatchConfig{}, FactionEnum::PLAYER1);
+    auto retire = std::make_shared<const spy::gameplay::RetireAction>(false, position, spy::util::UUID::generate());
+    EXPECT_FALSE(simulator.apply(retire));
+    EXPECT_EQ(simulator.getDepth(), 0U);
+}
+
+TEST_F(SimulatorTest, liveAIStateUnchanged) {
+    Simulator simulator(state, ai, spy::MatchConfig{}, FactionEnum::PLAYER1);
+    ASSERT_TRUE(simulator.apply(std::make_shared<const spy::gameplay::RetireAction>(false, position, id)));
+    EXPECT_EQ(ai.getNumberOfCheckpoints(), 0U);
+    EXPECT_EQ(state.getCharacters().findByUUID(id)->getActionPoints(), 2U);
+}
+
+TEST_F(SimulatorTest, determinizeAndUndo) {
+    auto other = spy::util::UUID::generate();
+    spy::character::Character otherCharacter(other, "Other");
+    otherCharacter.setCoordinates(spy::util::Point{2, 2});
+    state.getCharacters().insert(otherCharacter);
+    ai.unknownFaction[other] = {};
+    ai.excludedFactions[other] = {FactionEnum::PLAYER1, FactionEnum::PLAYER2};
+    ai.properties[id] = {};
+    ai.properties[other] = {};
+    auto collar = std::make_shared<spy::gadget::Gadget>(spy::gadget::GadgetEnum::DIAMOND_COLLAR);
+    ai.unknownGadgets[collar] = {{other, {1.0}}};
+
+    libclient::model::BeliefSampler sampler(16, 1, 1);
+    ASSERT_TRUE(sampler.reset(ai));
+    auto world = sampler.draw();
+    ASSERT_TRUE(world.has_value());
+
+    Simulator simulator(state, ai, spy::MatchConfig{}, FactionEnum::PLAYER1);
+    const auto hash = simulator.getHash();
+    simulator.determinize(world.value(), sampler);
+    EXPECT_EQ(simulator.getDepth(), 1U);
+    EXPECT_EQ(simulator.getAIState().npcFaction.count(other), 1U);
+    EXPECT_TRUE(simulator.getAIState().unknownGadgets.empty());
+    ASSERT_EQ(simulator.getAIState().characterGadgets.size(), 1U);
+    EXPECT_EQ(simulator.getAIState().characterGadgets.begin()->second, other);
+    EXPECT_NE(simulator.getHash(), hash);
+
+    ASSERT_TRUE(simulator.undo());
+    EXPECT_EQ(simulator.getDepth(), 0U);
+    EXPECT_EQ(simulator.getAIState().unknownFaction.count(other), 1U);
+    EXPECT_EQ(simulator.getAIState().unknownGadgets.size(), 1U);
+    EXPECT_EQ(simulator.getHash(), hash);
+    EXPECT_EQ(getCharacter(simulator, id).getCoordinates(), position);
+}
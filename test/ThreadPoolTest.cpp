@@ -0,0 +1,106 @@
+/**
+ * @file   ThreadPoolTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the work stealing thread pool.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <util/ThreadPool.hpp>
+
+using libclient::util::ThreadPool;
+
+TEST(ThreadPool, runsAllTasks) {
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.getNumberOfThreads(), 4U);
+    EXPECT_FALSE(pool.getCurrentWorker().has_value());
+
+    std::atomic<int> counter{0};
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < 100; i++) {
+        futures.push_back(pool.submit([&counter]() {
+            counter++;
+        }));
+    }
+    for (auto &future: futures) {
+        pool.wait(future);
+    }
+    EXPECT_EQ(counter, 100);
+}
+
+TEST(ThreadPool, parallelForCoversRange) {
+    ThreadPool pool(3);
+    std::vector<std::atomic<int>> visits(1000);
+    std::atomic<std::size_t> chunks{0};
+    pool.parallelFor(visits.size(), [&](std::size_t begin, std::size_t end, std::size_t) {
+        chunks++;
+        for (auto i = begin; i < end; i++) {
+            visits[i]++;
+        }
+    });
+    EXPECT_EQ(chunks, 3U);
+    for (const auto &v: visits) {
+        EXPECT_EQ(v, 1);
+    }
+
+    // no chunk for empty range
+    pool.parallelFor(0, [&](std::size_t, std::size_t, std::size_t) {
+        chunks++;
+    });
+    EXPECT_EQ(chunks, 3U);
+}
+
+TEST(ThreadPool, parallelForRethrows) {
+    ThreadPool pool(2);
+    std::atomic<int> finished{0};
+    // first chunk fails, the others still have to finish before parallelFor returns
+    EXPECT_THROW(pool.parallelFor(10, [&finished](std::size_t begin, std::size_t, std::size_t) {
+        if (begin == 0) {
+            throw std::runtime_error("chunk failed");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        finished++;
+    }), std::runtime_error);
+    EXPECT_EQ(finished, 1);
+}
+
+TEST(ThreadPool, idleWorkersSteal) {
+    ThreadPool pool(2);
+    std::mutex mutex;
+    std::set<std::size_t> workers;
+    std::atomic<int> counter{0};
+    std::size_t busyWorker = 0;
+
+    // subtasks go to the queue of the busy worker, the idle one has to steal them
+    auto outer = pool.submit([&]() {
+        busyWorker = pool.getCurrentWorker().value();
+        std::vector<std::future<void>> futures;
+        for (int i = 0; i < 8; i++) {
+            futures.push_back(pool.submit([&]() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    workers.insert(pool.getCurrentWorker().value());
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                counter++;
+            }));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        for (auto &future: futures) {
+            pool.wait(future);
+        }
+    });
+    // not pool.wait, the test thread must not run the subtasks itself
+    outer.get();
+
+    EXPECT_EQ(counter, 8);
+    EXPECT_GT(pool.getNumberOfSteals(), 0U);
+    workers.erase(busyWorker);
+    EXPECT_FALSE(workers.empty());
+}
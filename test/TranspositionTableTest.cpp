@@ -0,0 +1,98 @@
+/**
+ * @file   TranspositionTableTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of packing, probing and replacement of the transposition table.
+ */
+
+#include <gtest/gtest.h>
+#include <model/TranspositionTable.hpp>
+
+using libclient::model::TranspositionEntry;
+using libclient::model::TranspositionTable;
+
+namespace {
+    // one bucket of 4 slots (64 bytes) per shard -> all small hashes collide in shard 0
+    constexpr std::size_t oneBucketPerShard = 16 * 64;
+
+    TranspositionEntry entry(float value, std::uint16_t move, std::uint8_t depth) {
+        TranspositionEntry e;
+        e.value = value;
+        e.move = move;
+        e.depth = depth;
+        return e;
+    }
+}
+
+TEST(TranspositionTable, size) {
+    TranspositionTable table(oneBucketPerShard, 16);
+    EXPECT_EQ(table.getSizeInBytes(), oneBucketPerShard);
+    EXPECT_EQ(table.getNumberOfEntries(), 64U);
+
+    // rounded down to a power of two per shard
+    table.resize(3 * oneBucketPerShard);
+    EXPECT_EQ(table.getSizeInBytes(), 2 * oneBucketPerShard);
+}
+
+TEST(TranspositionTable, storeAndProbe) {
+    TranspositionTable table(1U << 16U, 4);
+    const std::uint64_t hash = 0xDEADBEEF12345678ULL;
+    EXPECT_FALSE(table.probe(hash).has_value());
+
+    table.store(hash, entry(-0.25F, 65535, 255));
+    auto stored = table.probe(hash);
+    ASSERT_TRUE(stored.has_value());
+    EXPECT_FLOAT_EQ(stored->value, -0.25F);
+    EXPECT_EQ(stored->move, 65535);
+    EXPECT_EQ(stored->depth, 255);
+
+    // an all zero entry is not mistaken for an empty slot
+    table.store(hash + 1, entry(0, 0, 0));
+    ASSERT_TRUE(table.probe(hash + 1).has_value());
+    EXPECT_FALSE(table.probe(hash + 2).has_value());
+
+    table.store(hash, entry(1.5F, 7, 3));
+    EXPECT_FLOAT_EQ(table.probe(hash)->value, 1.5F);
+    EXPECT_EQ(table.probe(hash)->move, 7);
+
+    auto statistics = table.getStatistics();
+    EXPECT_EQ(statistics.stores, 3U);
+    EXPECT_EQ(statistics.replacements, 0U);
+    EXPECT_EQ(statistics.probes, 6U);
+    EXPECT_EQ(statistics.hits, 4U);
+
+    table.clear();
+    EXPECT_FALSE(table.probe(hash).has_value());
+    EXPECT_EQ(table.getStatistics().stores, 0U);
+}
+
+TEST(TranspositionTable, replacesShallowestEntry) {
+    TranspositionTable table(oneBucketPerShard, 16);
+    for (std::uint64_t hash = 1; hash <= 4; hash++) {
+        table.store(hash, entry(0, 0, static_cast<std::uint8_t>(hash)));
+    }
+    EXPECT_EQ(table.getStatistics().replacements, 0U);
+
+    // bucket is full, entry with depth 1 is replaced
+    table.store(5, entry(0, 0, 9));
+    EXPECT_EQ(table.getStatistics().replacements, 1U);
+    EXPECT_FALSE(table.probe(1).has_value());
+    for (std::uint64_t hash = 2; hash <= 5; hash++) {
+        EXPECT_TRUE(table.probe(hash).has_value());
+    }
+}
+
+TEST(TranspositionTable, replacesOlderGenerationFirst) {
+    TranspositionTable table(oneBucketPerShard, 16);
+    for (std::uint64_t hash = 1; hash <= 4; hash++) {
+        table.store(hash, entry(0, 0, static_cast<std::uint8_t>(hash)));
+    }
+
+    // shallowest entry is refreshed in the new search, the shallowest old entry goes instead
+    table.newGeneration();
+    table.store(1, entry(0, 0, 1));
+    table.store(5, entry(0, 0, 0));
+    EXPECT_TRUE(table.probe(1).has_value());
+    EXPECT_FALSE(table.probe(2).has_value());
+    EXPECT_TRUE(table.probe(5).has_value());
+}
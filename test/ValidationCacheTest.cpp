@@ -0,0 +1,64 @@
+/**
+ * @file   ValidationCacheTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the cache of validation results.
+ */
+
+#include <gtest/gtest.h>
+#include <datatypes/gameplay/GadgetAction.hpp>
+#include <datatypes/gameplay/GambleAction.hpp>
+#include <model/ValidationCache.hpp>
+
+using libclient::model::ValidationCache;
+using spy::gadget::GadgetEnum;
+using spy::network::RoleEnum;
+
+TEST(ValidationCache, makeKey) {
+    auto id = spy::util::UUID::generate();
+    spy::util::Point target{2, 3};
+    auto hairdryer = ValidationCache::makeKey(spy::gameplay::GadgetAction(false, target, id, GadgetEnum::HAIRDRYER));
+    auto cocktail = ValidationCache::makeKey(spy::gameplay::GadgetAction(false, target, id, GadgetEnum::COCKTAIL));
+    EXPECT_EQ(hairdryer.character, id);
+    EXPECT_EQ(hairdryer.target, target);
+    EXPECT_FALSE(hairdryer == cocktail);
+    EXPECT_TRUE(hairdryer == ValidationCache::makeKey(
+            spy::gameplay::GadgetAction(true, target, id, GadgetEnum::HAIRDRYER)));
+
+    auto low = ValidationCache::makeKey(spy::gameplay::GambleAction(false, target, id, 1));
+    auto high = ValidationCache::makeKey(spy::gameplay::GambleAction(false, target, id, 5));
+    EXPECT_FALSE(low == high);
+}
+
+TEST(ValidationCache, scopedByVersionCharacterAndRole) {
+    ValidationCache cache;
+    auto active = spy::util::UUID::generate();
+    auto key = ValidationCache::makeKey(spy::gameplay::GadgetAction(false, {1, 1}, active, GadgetEnum::HAIRDRYER));
+
+    EXPECT_FALSE(cache.lookup(key, 1, active, RoleEnum::PLAYER).has_value());
+    cache.store(key, true, 1, active, RoleEnum::PLAYER);
+    EXPECT_EQ(cache.lookup(key, 1, active, RoleEnum::PLAYER), true);
+
+    // validation of GameOperation depends on the role, results of another role are dropped
+    EXPECT_FALSE(cache.lookup(key, 1, active, RoleEnum::SPECTATOR).has_value());
+    EXPECT_FALSE(cache.lookup(key, 1, active, RoleEnum::PLAYER).has_value());
+
+    cache.store(key, false, 1, active, RoleEnum::PLAYER);
+    EXPECT_EQ(cache.lookup(key, 1, active, RoleEnum::PLAYER), false);
+    EXPECT_FALSE(cache.lookup(key, 1, spy::util::UUID::generate(), RoleEnum::PLAYER).has_value());
+
+    cache.store(key, true, 1, active, RoleEnum::PLAYER);
+    EXPECT_FALSE(cache.lookup(key, 2, active, RoleEnum::PLAYER).has_value());
+    EXPECT_EQ(cache.getSizeInBytes(), 0U);
+}
+
+TEST(ValidationCache, statistics) {
+    ValidationCache cache;
+    cache.recordSubmission(0.5, false);
+    cache.recordSubmission(0.25, true);
+    const auto &statistics = cache.getStatistics();
+    EXPECT_EQ(statistics.submissions, 2U);
+    EXPECT_EQ(statistics.cacheHits, 1U);
+    EXPECT_DOUBLE_EQ(statistics.lastSeconds, 0.25);
+    EXPECT_DOUBLE_EQ(statistics.totalSeconds, 0.75);
+}
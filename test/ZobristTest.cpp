@@ -0,0 +1,141 @@
+/**
+ * @file   ZobristTest.cpp
+ * @author agent
+ * @date   19.10.2026 (creation)
+ * @brief  Tests of the zobrist keys.
+ */
+
+#include <gtest/gtest.h>
+#include <model/Zobrist.hpp>
+
+using libclient::model::AIState;
+using libclient::model::ZobristKeys;
+using libclient::model::ZobristPoints;
+using spy::scenario::FieldStateEnum;
+using spy::util::Point;
+
+namespace {
+    struct ZobristTest : public ::testing::Test {
+        spy::gameplay::State state;
+        spy::util::UUID first = spy::util::UUID::generate();
+        spy::util::UUID second = spy::util::UUID::generate();
+
+        void SetUp() override {
+            using spy::scenario::Field;
+            std::vector<std::vector<Field>> rows(3, std::vector<Field>(4, Field(FieldStateEnum::FREE)));
+            rows[1][1] = Field(FieldStateEnum::WALL);
+            state.getMap() = spy::scenario::FieldMap(rows);
+
+            spy::character::Character character(first, "First");
+            character.setCoordinates(Point{0, 0});
+            state.getCharacters().insert(character);
+            state.getCharacters().insert(spy::character::Character(second, "Second"));
+        }
+    };
+}
+
+TEST_F(ZobristTest, deterministicKeys) {
+    ZobristKeys keys(state);
+    EXPECT_EQ(ZobristKeys(state).hashState(state), keys.hashState(state));
+    EXPECT_NE(ZobristKeys(state, 1).hashState(state), keys.hashState(state));
+
+    EXPECT_EQ(keys.getCharacterIndex(first), 0U);
+    EXPECT_EQ(keys.getCharacterIndex(second), 1U);
+    EXPECT_FALSE(keys.getCharacterIndex(spy::util::UUID::generate()).has_value());
+
+    EXPECT_NE(keys.position(0, Point{0, 0}), keys.position(0, Point{1, 0}));
+    EXPECT_NE(keys.position(0, Point{0, 0}), keys.position(1, Point{0, 0}));
+    EXPECT_NE(keys.position(0, std::nullopt), keys.position(0, Point{0, 0}));
+    EXPECT_EQ(keys.points(0, ZobristPoints::CHIPS, 3),
+              keys.points(0, ZobristPoints::CHIPS, 3 + ZobristKeys::maxPoints));
+    EXPECT_EQ(keys.field(Point{4, 0}, FieldStateEnum::FREE), 0U);
+    EXPECT_EQ(keys.fog(Point{0, -1}), 0U);
+}
+
+TEST_F(ZobristTest, incrementalUpdates) {
+    ZobristKeys keys(state);
+    auto hash = keys.hashState(state);
+
+    // character enters the map and first one moves
+    auto character = state.getCharacters().getByUUID(second);
+    character->setCoordinates(Point{3, 2});
+    hash ^= keys.position(1, std::nullopt) ^ keys.position(1, Point{3, 2});
+    EXPECT_EQ(keys.hashState(state), hash);
+    character = state.getCharacters().getByUUID(first);
+    character->setCoordinates(Point{1, 0});
+    character->setMovePoints(2);
+    hash ^= keys.position(0, Point{0, 0}) ^ keys.position(0, Point{1, 0});
+    hash ^= keys.points(0, ZobristPoints::MOVE_POINTS, 0) ^ keys.points(0, ZobristPoints::MOVE_POINTS, 2);
+    EXPECT_EQ(keys.hashState(state), hash);
+
+    // wall destroyed, fog and gadget on a field
+    auto &wall = state.getMap().getField(Point{1, 1});
+    wall = spy::scenario::Field(FieldStateEnum::FREE);
+    hash ^= keys.field(Point{1, 1}, FieldStateEnum::WALL) ^ keys.field(Point{1, 1}, FieldStateEnum::FREE);
+    EXPECT_EQ(keys.hashState(state), hash);
+    state.getMap().getField(Point{2, 0}).setFoggy(true);
+    hash ^= keys.fog(Point{2, 0});
+    EXPECT_EQ(keys.hashState(state), hash);
+    state.getMap().getField(Point{0, 2}).setGadget(
+            std::make_shared<spy::gadget::Gadget>(spy::gadget::GadgetEnum::DIAMOND_COLLAR));
+    hash ^= keys.fieldGadget(Point{0, 2}, spy::gadget::GadgetEnum::DIAMOND_COLLAR);
+    EXPECT_EQ(keys.hashState(state), hash);
+
+    // characters not known to the keys are ignored
+    spy::character::Character stranger(spy::util::UUID::generate(), "Stranger");
+    stranger.setCoordinates(Point{2, 2});
+    state.getCharacters().insert(stranger);
+    EXPECT_EQ(keys.hashState(state), hash);
+}
+
+TEST_F(ZobristTest, beliefs) {
+    ZobristKeys keys(state);
+    AIState ai;
+    auto empty = keys.hashBeliefs(ai);
+
+    ai.myFaction.insert(first);
+    auto mine = keys.hashBeliefs(ai);
+    EXPECT_NE(mine, empty);
+    ai.myFaction.clear();
+    ai.enemyFaction.insert(first);
+    EXPECT_NE(keys.hashBeliefs(ai), mine);
+    ai.enemyFaction.clear();
+    ai.excludedFactions[first].insert(spy::character::FactionEnum::PLAYER1);
+    EXPECT_NE(keys.hashBeliefs(ai), mine);
+    EXPECT_NE(keys.hashBeliefs(ai), empty);
+    ai.excludedFactions.clear();
+
+    // certainties of unknown characters are not hashed
+    ai.unknownFaction[second] = {{spy::character::FactionEnum::PLAYER1, {0.5}}};
+    EXPECT_EQ(keys.hashBeliefs(ai), empty);
+    ai.unknownFaction[second] = {{spy::character::FactionEnum::PLAYER1, {0.9}}};
+    EXPECT_EQ(keys.hashBeliefs(ai), empty);
+
+    auto collar = std::make_shared<spy::gadget::Gadget>(spy::gadget::GadgetEnum::DIAMOND_COLLAR);
+    ai.characterGadgets[collar] = second;
+    auto held = keys.hashBeliefs(ai);
+    EXPECT_NE(held, empty);
+    ai.characterGadgets.clear();
+    ai.floorGadgets.insert(collar);
+    EXPECT_NE(keys.hashBeliefs(ai), held);
+    EXPECT_NE(keys.hashBeliefs(ai), empty);
+    ai.floorGadgets.clear();
+
+    ai.safeCombinations.insert(1);
+    auto combination = keys.hashBeliefs(ai);
+    EXPECT_NE(combination, empty);
+    ai.safeCombinations.clear();
+    ai.openedSafes.insert(1);
+    EXPECT_NE(keys.hashBeliefs(ai), combination);
+    ai.openedSafes.clear();
+    ai.gotRidOfMoleDie = true;
+    EXPECT_NE(keys.hashBeliefs(ai), empty);
+    ai.gotRidOfMoleDie = false;
+    EXPECT_EQ(keys.hashBeliefs(ai), empty);
+}
+
+TEST(Zobrist, mix) {
+    EXPECT_EQ(ZobristKeys::mix(1), ZobristKeys::mix(1));
+    EXPECT_NE(ZobristKeys::mix(1), ZobristKeys::mix(2));
+    EXPECT_NE(ZobristKeys::mix(0), 0U);
+}